@@ -0,0 +1,40 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/BackupInfo.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public value struct BackupInfo
+    {
+        internal:
+            BackupInfo(const ::BackupInfo& info)
+                : BackupId(info.backupId),
+                  Timestamp(DateTimeOffset::FromUnixTimeSeconds(static_cast<Int64>(info.timestamp))),
+                  NumFiles(info.numFiles), Size(info.size), BytesCopied(info.bytesCopied) {}
+
+        public:
+            initonly UInt32 BackupId;
+            initonly DateTimeOffset Timestamp;
+            initonly UInt32 NumFiles;
+            initonly UInt64 Size;
+            // The part of Size that had to be copied, the rest is shared with earlier backups
+            initonly UInt64 BytesCopied;
+    };
+}
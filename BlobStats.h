@@ -0,0 +1,37 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/BlobStats.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public value struct BlobStats
+    {
+        internal:
+            BlobStats(const ::BlobStats& stats)
+                : NumFiles(stats.numFiles), TotalFileSize(stats.totalFileSize),
+                  LiveFileSize(stats.liveFileSize), GarbageSize(stats.garbageSize) {}
+
+        public:
+            initonly UInt64 NumFiles;
+            initonly UInt64 TotalFileSize;
+            initonly UInt64 LiveFileSize;
+            initonly UInt64 GarbageSize;
+    };
+}
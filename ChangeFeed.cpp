@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pch.h"
+#include "ChangeFeed.h"
+#include "KeyValueStore.h"
+
+namespace librocks::Net {
+
+    ChangeFeed::!ChangeFeed()
+    {
+        if (_nativePtr) {
+            delete _nativePtr;
+            _nativePtr = nullptr;
+            _owner->RemoveDependent(this);
+        }
+    }
+
+    void ChangeFeed::ThrowIfDisposed()
+    {
+        if (_nativePtr == nullptr) throw gcnew ObjectDisposedException("ChangeFeed");
+        // the native feed reads the store's WAL, so it must still be open
+        if (!_owner->IsOpen) throw gcnew ObjectDisposedException("KeyValueStore");
+    }
+
+    IReadOnlyList<ChangeSet^>^ ChangeFeed::Poll(int maxBatches)
+    {
+        ThrowIfDisposed();
+        if (maxBatches <= 0) throw gcnew ArgumentOutOfRangeException("maxBatches");
+        try {
+            std::vector<::ChangeSet> batches = _nativePtr->poll(static_cast<size_t>(maxBatches));
+            List<ChangeSet^>^ managedList = gcnew List<ChangeSet^>(static_cast<int>(batches.size()));
+            for (const ::ChangeSet& batch : batches) {
+                List<Change>^ changes = gcnew List<Change>(static_cast<int>(batch.changes.size()));
+                for (const ::Change& change : batch.changes) {
+                    changes->Add(Change(_owner->WrapKind(change.kind), static_cast<ChangeType>(change.type),
+                        ToArray(change.key), ToArray(change.value)));
+                }
+                managedList->Add(gcnew ChangeSet(batch.sequenceNumber, changes->AsReadOnly()));
+            }
+            return managedList->AsReadOnly();
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Poll() operation.");
+        }
+    }
+
+    array<Byte>^ ChangeFeed::ToArray(const std::string& bytes)
+    {
+        array<Byte>^ managed = gcnew array<Byte>(static_cast<int>(bytes.size()));
+        if (managed->Length > 0) {
+            Marshal::Copy(IntPtr(const_cast<char*>(bytes.data())), managed, 0, managed->Length);
+        }
+        return managed;
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/ChangeStream.h"
+#include "ChangeSet.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace librocks::Net {
+
+    ref class KeyValueStore;
+
+    // Reads the committed write batches of a KeyValueStore from its WAL, in commit order.
+    // Persist Position to resume with KeyValueStore::OpenChangeFeed() after a restart.
+    public ref class ChangeFeed sealed : public IDisposable
+    {
+        internal:
+            ChangeFeed(KeyValueStore^ owner, ChangeStream* nativeStream) : _nativePtr(nativeStream), _owner(owner) {}
+
+        public:
+            // Inherited via IDisposable
+            ~ChangeFeed() { this->!ChangeFeed(); } // Dispose()
+
+        protected:
+            // Finalizer
+            !ChangeFeed();
+
+        public:
+            // Returns up to maxBatches write batches, an empty list means that the feed has caught up
+            IReadOnlyList<ChangeSet^>^ Poll(int maxBatches);
+
+            IReadOnlyList<ChangeSet^>^ Poll() {
+                return Poll(64);
+            }
+
+            // Sequence number where the next Poll() continues
+            property UInt64 Position {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->position();
+                }
+            }
+
+        private:
+            ChangeStream* _nativePtr;
+            KeyValueStore^ _owner;
+
+            static array<Byte>^ ToArray(const std::string& bytes);
+
+            void ThrowIfDisposed();
+    };
+}
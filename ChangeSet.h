@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/ChangeFeed.h"
+#include "Kind.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace librocks::Net {
+
+    public enum class ChangeType {
+        Put = ::ChangeType::Put,
+        Remove = ::ChangeType::Remove,
+        SingleRemove = ::ChangeType::SingleRemove,
+        // Key is the begin (inclusive) and Value the end key (exclusive) of the removed range
+        RemoveRange = ::ChangeType::RemoveRange,
+        Merge = ::ChangeType::Merge
+    };
+
+    public value struct Change
+    {
+        internal:
+            Change(librocks::Net::Kind^ kind, ChangeType type, array<Byte>^ key, array<Byte>^ value)
+                : Kind(kind), Type(type), Key(key), Value(value) {}
+
+        public:
+            initonly librocks::Net::Kind^ Kind;
+            initonly ChangeType Type;
+            initonly array<Byte>^ Key;
+            // Empty for removals
+            initonly array<Byte>^ Value;
+    };
+
+    // The changes of one committed write batch
+    public ref class ChangeSet sealed
+    {
+        internal:
+            ChangeSet(UInt64 sequenceNumber, IReadOnlyList<Change>^ changes)
+                : _sequenceNumber(sequenceNumber), _changes(changes) {}
+
+        public:
+            // Sequence number of the first change, the following changes have consecutive numbers
+            property UInt64 SequenceNumber {
+                UInt64 get() { return _sequenceNumber; }
+            }
+
+            property IReadOnlyList<Change>^ Changes {
+                IReadOnlyList<Change>^ get() { return _changes; }
+            }
+
+        private:
+            UInt64 _sequenceNumber;
+            IReadOnlyList<Change>^ _changes;
+    };
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pch.h"
+#include "CompactionJob.h"
+#include "KeyValueStore.h"
+
+namespace librocks::Net {
+
+    CompactionJob::!CompactionJob()
+    {
+        if (_nativePtr) {
+            // cancels a running compaction and waits for it
+            delete _nativePtr;
+            _nativePtr = nullptr;
+            _owner->RemoveDependent(this);
+        }
+    }
+
+    void CompactionJob::ThrowIfDisposed()
+    {
+        if (_nativePtr == nullptr) throw gcnew ObjectDisposedException("CompactionJob");
+        // the compaction refers to the store, so it must still be open
+        if (!_owner->IsOpen) throw gcnew ObjectDisposedException("KeyValueStore");
+    }
+
+    bool CompactionJob::Wait(TimeSpan timeout)
+    {
+        ThrowIfDisposed();
+        if (timeout < TimeSpan::Zero) throw gcnew ArgumentOutOfRangeException("timeout");
+        try {
+            return _nativePtr->wait(std::chrono::milliseconds(static_cast<long long>(timeout.TotalMilliseconds)));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred while waiting for a range compaction.");
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/Compaction.h"
+#include "RocksDbException.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    ref class KeyValueStore;
+
+    // Handle of a range compaction that runs in the background.
+    // Disposing the handle of a still running compaction cancels it and waits
+    // until it has stopped, closing the KeyValueStore does so for all its jobs.
+    public ref class CompactionJob sealed : public IDisposable
+    {
+        internal:
+            CompactionJob(KeyValueStore^ owner, Compaction* nativeCompaction)
+                : _owner(owner), _nativePtr(nativeCompaction) {}
+
+        public:
+            // Inherited via IDisposable
+            ~CompactionJob() { this->!CompactionJob(); } // Dispose()
+
+        protected:
+            // Finalizer
+            !CompactionJob();
+
+        public:
+            property bool IsDone {
+                bool get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->isDone();
+                }
+            }
+
+            property bool IsCancelled {
+                bool get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->isCancelled();
+                }
+            }
+
+            property UInt64 BytesRead {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->bytesRead();
+                }
+            }
+
+            property UInt64 BytesWritten {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->bytesWritten();
+                }
+            }
+
+            property UInt64 FilesIn {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->filesIn();
+                }
+            }
+
+            property UInt64 FilesOut {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->filesOut();
+                }
+            }
+
+            void Cancel() {
+                ThrowIfDisposed();
+                _nativePtr->cancel();
+            }
+
+            // Returns true if the compaction has finished within the timeout.
+            // Throws a RocksDbException if it has finished with an error.
+            bool Wait(TimeSpan timeout);
+
+            void Wait() {
+                while (!Wait(TimeSpan::FromSeconds(1))) {
+                }
+            }
+
+        private:
+            KeyValueStore^ _owner;
+            Compaction* _nativePtr;
+
+            void ThrowIfDisposed();
+    };
+}
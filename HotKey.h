@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/HotKeyTracker.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace librocks::Net {
+
+    public value struct HotKey
+    {
+        internal:
+            HotKey(const ::HotKey& hot)
+                : Key(gcnew array<Byte>(static_cast<int>(hot.key.size()))), EstimatedCount(hot.estimatedCount) {
+                if (Key->Length > 0) {
+                    Marshal::Copy(IntPtr(const_cast<char*>(hot.key.data())), Key, 0, Key->Length);
+                }
+            }
+
+        public:
+            // Truncated to 128 bytes for longer keys
+            initonly array<Byte>^ Key;
+            // Estimated number of operations on the key (or prefix)
+            initonly UInt64 EstimatedCount;
+    };
+}
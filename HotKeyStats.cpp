@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pch.h"
+#include "HotKeyStats.h"
+
+#include <msclr/marshal_cppstd.h>
+
+namespace librocks::Net {
+
+    HotKeyStats::HotKeyStats(const ::HotKeyStats& stats)
+        : _kindName(msclr::interop::marshal_as<String^>(stats.kindName)), _sampledReads(stats.sampledReads),
+          _sampledWrites(stats.sampledWrites), _readKeys(Wrap(stats.readKeys)), _writeKeys(Wrap(stats.writeKeys)),
+          _readPrefixes(Wrap(stats.readPrefixes)), _writePrefixes(Wrap(stats.writePrefixes))
+    {
+    }
+
+    IReadOnlyList<HotKey>^ HotKeyStats::Wrap(const std::vector<::HotKey>& hotKeys)
+    {
+        List<HotKey>^ managedList = gcnew List<HotKey>(static_cast<int>(hotKeys.size()));
+        for (const ::HotKey& hot : hotKeys) {
+            managedList->Add(HotKey(hot));
+        }
+        return managedList->AsReadOnly();
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/HotKeyTracker.h"
+#include "HotKey.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace librocks::Net {
+
+    // The hottest keys of a Kind since the last KeyValueStore::ResetHotKeys(), hottest first
+    public ref class HotKeyStats sealed
+    {
+        internal:
+            HotKeyStats(const ::HotKeyStats& stats);
+
+        public:
+            property String^ KindName {
+                String^ get() { return _kindName; }
+            }
+
+            property UInt64 SampledReads {
+                UInt64 get() { return _sampledReads; }
+            }
+
+            property UInt64 SampledWrites {
+                UInt64 get() { return _sampledWrites; }
+            }
+
+            property IReadOnlyList<HotKey>^ ReadKeys {
+                IReadOnlyList<HotKey>^ get() { return _readKeys; }
+            }
+
+            property IReadOnlyList<HotKey>^ WriteKeys {
+                IReadOnlyList<HotKey>^ get() { return _writeKeys; }
+            }
+
+            // Empty unless KeyValueStoreOptions::HotKeyPrefixLength is set
+            property IReadOnlyList<HotKey>^ ReadPrefixes {
+                IReadOnlyList<HotKey>^ get() { return _readPrefixes; }
+            }
+
+            property IReadOnlyList<HotKey>^ WritePrefixes {
+                IReadOnlyList<HotKey>^ get() { return _writePrefixes; }
+            }
+
+        private:
+            static IReadOnlyList<HotKey>^ Wrap(const std::vector<::HotKey>& hotKeys);
+
+            String^ _kindName;
+            UInt64 _sampledReads;
+            UInt64 _sampledWrites;
+            IReadOnlyList<HotKey>^ _readKeys;
+            IReadOnlyList<HotKey>^ _writeKeys;
+            IReadOnlyList<HotKey>^ _readPrefixes;
+            IReadOnlyList<HotKey>^ _writePrefixes;
+    };
+}
@@ -38,6 +38,40 @@ namespace librocks::Net {
         return gcnew Kind(nativePtr);
     }
 
+    // Turns the perf context captured by the native layer (if the last operation on
+    // this thread was sampled) into a finished Activity with one tag per counter
+    void KeyValueStore::RecordPerfSample(String^ operation)
+    {
+        ::PerfSample sample;
+        if (!KVStore::takePerfSample(&sample) || !PerfActivitySource->HasListeners()) return;
+
+        // TimeSpan ticks are 100 ns
+        TimeSpan elapsed = TimeSpan::FromTicks(static_cast<Int64>(sample.elapsedNanos / 100));
+        DateTimeOffset startTime = DateTimeOffset::UtcNow - elapsed;
+        Diagnostics::Activity^ activity = PerfActivitySource->StartActivity("KeyValueStore." + operation,
+            Diagnostics::ActivityKind::Internal, Diagnostics::ActivityContext(), nullptr, nullptr, startTime);
+        if (activity == nullptr) return;
+
+        activity->SetTag("rocksdb.block_read_count", sample.blockReadCount);
+        activity->SetTag("rocksdb.block_read_bytes", sample.blockReadBytes);
+        activity->SetTag("rocksdb.block_read_nanos", sample.blockReadNanos);
+        activity->SetTag("rocksdb.block_cache_hit_count", sample.blockCacheHitCount);
+        activity->SetTag("rocksdb.block_decompress_nanos", sample.blockDecompressNanos);
+        activity->SetTag("rocksdb.bloom_sst_miss_count", sample.bloomSstMissCount);
+        activity->SetTag("rocksdb.bloom_sst_hit_count", sample.bloomSstHitCount);
+        activity->SetTag("rocksdb.get_from_memtable_nanos", sample.getFromMemtableNanos);
+        activity->SetTag("rocksdb.get_from_output_files_nanos", sample.getFromOutputFilesNanos);
+        activity->SetTag("rocksdb.db_mutex_lock_nanos", sample.dbMutexLockNanos);
+        activity->SetTag("rocksdb.db_condition_wait_nanos", sample.dbConditionWaitNanos);
+        activity->SetTag("rocksdb.write_wal_nanos", sample.writeWalNanos);
+        activity->SetTag("rocksdb.write_memtable_nanos", sample.writeMemtableNanos);
+        activity->SetTag("rocksdb.write_delay_nanos", sample.writeDelayNanos);
+        activity->SetTag("rocksdb.file_read_nanos", sample.fileReadNanos);
+        activity->SetTag("rocksdb.file_bytes_read", sample.fileBytesRead);
+        activity->SetTag("rocksdb.fsync_nanos", sample.fsyncNanos);
+        activity->Stop();
+    }
+
     Kind^ KeyValueStore::GetDefaultKind()
     {
         ThrowIfDisposed();
@@ -72,6 +106,26 @@ namespace librocks::Net {
         }
     }
 
+    Kind^ KeyValueStore::GetOrCreateKind(String^ kindName, KindOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kindName == nullptr) throw gcnew ArgumentNullException("kindName");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+        ::KindOptions nativeOptions = options->ToNative();
+        try {
+            std::string colFamily{ marshal::marshal_as<std::string>(kindName) };
+            const ::Kind& nativeKind = _nativePtr->getOrCreateKind(colFamily, nativeOptions);
+            return WrapKind(&nativeKind);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred while retrieving or creating the Kind: "
+                + kindName);
+        }
+    }
+
     IReadOnlyCollection<Kind^>^ KeyValueStore::GetKinds()
     {
         ThrowIfDisposed();
@@ -96,6 +150,22 @@ namespace librocks::Net {
         }
     }
 
+    KindOptions^ KeyValueStore::GetKindOptions(Kind^ kind)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        try {
+            return gcnew KindOptions(_nativePtr->getKindOptions(*(kind->_nativePtr)));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred while retrieving the options of the Kind: "
+                + kind->Name);
+        }
+    }
+
     void KeyValueStore::Compact(Kind^ kind)
     {
         ThrowIfDisposed();
@@ -120,158 +190,935 @@ namespace librocks::Net {
     {
         ThrowIfDisposed();
         try {
-            _nativePtr->compactAll();
+            _nativePtr->compactAll();
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred during CompactAll() compaction.");
+        }
+    }
+
+    void KeyValueStore::TryCatchUpWithPrimary()
+    {
+        ThrowIfDisposed();
+
+        try {
+            _nativePtr->tryCatchUpWithPrimary();
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during TryCatchUpWithPrimary() operation.");
+        }
+    }
+
+    void KeyValueStore::SetRateLimits(RateLimits^ limits)
+    {
+        ThrowIfDisposed();
+        if (limits == nullptr) throw gcnew ArgumentNullException("limits");
+        try {
+            _nativePtr->setRateLimits(limits->ToNative());
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred during SetRateLimits() operation.");
+        }
+    }
+
+    RateLimits^ KeyValueStore::GetRateLimits()
+    {
+        ThrowIfDisposed();
+        try {
+            return gcnew RateLimits(_nativePtr->getRateLimits());
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred during GetRateLimits() operation.");
+        }
+    }
+
+    void KeyValueStore::SetCompactionFilter(Kind^ kind, RetentionRules^ rules)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (rules == nullptr) throw gcnew ArgumentNullException("rules");
+        ::RetentionRules nativeRules = rules->ToNative();
+        try {
+            _nativePtr->setCompactionFilter(*(kind->_nativePtr), nativeRules);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred while setting the compaction filter of : "
+                + kind->Name);
+        }
+    }
+
+    void KeyValueStore::ClearCompactionFilter(Kind^ kind)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        try {
+            _nativePtr->clearCompactionFilter(*(kind->_nativePtr));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred while clearing the compaction filter of : "
+                + kind->Name);
+        }
+    }
+
+    ReadCacheStats KeyValueStore::GetReadCacheStats()
+    {
+        ThrowIfDisposed();
+        return ReadCacheStats(_nativePtr->getReadCacheStats());
+    }
+
+    IReadOnlyList<HotKeyStats^>^ KeyValueStore::GetHotKeys()
+    {
+        ThrowIfDisposed();
+        try {
+            const std::vector<::HotKeyStats> nativeStats = _nativePtr->getHotKeys();
+            List<HotKeyStats^>^ managedList = gcnew List<HotKeyStats^>(static_cast<int>(nativeStats.size()));
+            for (const ::HotKeyStats& stats : nativeStats) {
+                managedList->Add(gcnew HotKeyStats(stats));
+            }
+            return managedList->AsReadOnly();
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during GetHotKeys() operation.");
+        }
+    }
+
+    void KeyValueStore::ResetHotKeys()
+    {
+        ThrowIfDisposed();
+        _nativePtr->resetHotKeys();
+    }
+
+    TraceReplayReport KeyValueStore::ReplayTrace(String^ tracePath, String^ storePath, double speedup)
+    {
+        if (tracePath == nullptr) throw gcnew ArgumentNullException("tracePath");
+        if (storePath == nullptr) throw gcnew ArgumentNullException("storePath");
+        if (!(speedup >= 0.0)) throw gcnew ArgumentOutOfRangeException("speedup");
+
+        std::string trace{ marshal::marshal_as<std::string>(tracePath) };
+        std::string store{ marshal::marshal_as<std::string>(storePath) };
+        try {
+            return TraceReplayReport(KVStore::replayTrace(trace, store, speedup));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during ReplayTrace() operation.");
+        }
+    }
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+    CompactionJob^ KeyValueStore::CompactRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive)
+    {
+        return CompactRange(kind, beginKeyInclusive, endKeyExclusive, -1, 0);
+    }
+
+    // An empty beginKeyInclusive / endKeyExclusive means unbounded on that side
+    CompactionJob^ KeyValueStore::CompactRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        int targetLevel, int maxSubcompactions)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (maxSubcompactions < 0) throw gcnew ArgumentOutOfRangeException("maxSubcompactions");
+
+        // default-constructed string_views are passed as nullptr (unbounded)
+        std::string_view nativeBeginView;
+        std::string_view nativeEndView;
+
+        pin_ptr<const Byte> pBegin;
+        pin_ptr<const Byte> pEnd;
+
+        if (beginKeyInclusive.Length > 0) {
+            pBegin = &MemoryMarshal::GetReference(beginKeyInclusive);
+            nativeBeginView = std::string_view(reinterpret_cast<const char*>(pBegin), beginKeyInclusive.Length);
+        }
+
+        if (endKeyExclusive.Length > 0) {
+            pEnd = &MemoryMarshal::GetReference(endKeyExclusive);
+            nativeEndView = std::string_view(reinterpret_cast<const char*>(pEnd), endKeyExclusive.Length);
+        }
+
+        try {
+            Compaction* nativeCompaction = _nativePtr->compactRange(*(kind->_nativePtr), nativeBeginView,
+                nativeEndView, targetLevel, static_cast<unsigned int>(maxSubcompactions));
+            CompactionJob^ job = gcnew CompactionJob(this, nativeCompaction);
+            AddDependent(job);
+            return job;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred while starting a range compaction of : "
+                + kind->Name);
+        }
+    }
+
+#pragma warning(pop)
+
+    Snapshot^ KeyValueStore::GetSnapshot()
+    {
+        ThrowIfDisposed();
+        try {
+            const ::Snapshot* nativeSnapshot = _nativePtr->getSnapshot();
+            Snapshot^ snapshot = gcnew Snapshot(this, nativeSnapshot);
+            AddDependent(snapshot);
+            return snapshot;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred while creating a Snapshot.");
+        }
+    }
+
+    void KeyValueStore::CreateCheckpoint(String^ dir)
+    {
+        ThrowIfDisposed();
+        if (dir == nullptr) throw gcnew ArgumentNullException("dir");
+
+        std::string nativeDir{ marshal::marshal_as<std::string>(dir) };
+        try {
+            _nativePtr->createCheckpoint(nativeDir);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during CreateCheckpoint() operation.");
+        }
+    }
+
+    BackupInfo KeyValueStore::CreateBackup(String^ backupDir)
+    {
+        return CreateBackup(backupDir, true);
+    }
+
+    BackupInfo KeyValueStore::CreateBackup(String^ backupDir, bool flushBeforeBackup)
+    {
+        ThrowIfDisposed();
+        if (backupDir == nullptr) throw gcnew ArgumentNullException("backupDir");
+
+        std::string nativeDir{ marshal::marshal_as<std::string>(backupDir) };
+        try {
+            return BackupInfo(_nativePtr->createBackup(nativeDir, flushBeforeBackup));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during CreateBackup() operation.");
+        }
+    }
+
+    void KeyValueStore::RestoreBackup(String^ backupDir, String^ restoreDir)
+    {
+        RestoreBackup(backupDir, restoreDir, 0);
+    }
+
+    void KeyValueStore::RestoreBackup(String^ backupDir, String^ restoreDir, UInt32 backupId)
+    {
+        if (backupDir == nullptr) throw gcnew ArgumentNullException("backupDir");
+        if (restoreDir == nullptr) throw gcnew ArgumentNullException("restoreDir");
+
+        std::string nativeBackupDir{ marshal::marshal_as<std::string>(backupDir) };
+        std::string nativeRestoreDir{ marshal::marshal_as<std::string>(restoreDir) };
+        try {
+            KVStore::restoreBackup(nativeBackupDir, nativeRestoreDir, backupId);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during RestoreBackup() operation.");
+        }
+    }
+
+    void KeyValueStore::PurgeOldBackups(String^ backupDir, UInt32 numToKeep)
+    {
+        if (backupDir == nullptr) throw gcnew ArgumentNullException("backupDir");
+
+        std::string nativeDir{ marshal::marshal_as<std::string>(backupDir) };
+        try {
+            KVStore::purgeOldBackups(nativeDir, numToKeep);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during PurgeOldBackups() operation.");
+        }
+    }
+
+    ChangeFeed^ KeyValueStore::OpenChangeFeed(UInt64 fromSequenceNumber)
+    {
+        ThrowIfDisposed();
+        try {
+            ChangeStream* nativeStream = _nativePtr->openChangeStream(fromSequenceNumber);
+            ChangeFeed^ feed = gcnew ChangeFeed(this, nativeStream);
+            AddDependent(feed);
+            return feed;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred while opening a ChangeFeed.");
+        }
+    }
+
+    SstWriter^ KeyValueStore::CreateSstWriter(Kind^ kind)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        try {
+            SstFileWriter* nativeWriter = _nativePtr->createSstFileWriter(*(kind->_nativePtr));
+            SstWriter^ writer = gcnew SstWriter(this, nativeWriter);
+            AddDependent(writer);
+            return writer;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred while creating an SstWriter for: "
+                + kind->Name);
+        }
+    }
+
+    void KeyValueStore::Ingest(Kind^ kind, IEnumerable<String^>^ filePaths)
+    {
+        Ingest(kind, filePaths, true);
+    }
+
+    void KeyValueStore::Ingest(Kind^ kind, IEnumerable<String^>^ filePaths, bool moveFiles)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (filePaths == nullptr) throw gcnew ArgumentNullException("filePaths");
+        std::vector<std::string> paths;
+        for each (String^ path in filePaths) {
+            if (path == nullptr) throw gcnew ArgumentException("filePaths must not contain null", "filePaths");
+            paths.push_back(marshal::marshal_as<std::string>(path));
+        }
+        try {
+            _nativePtr->ingest(*(kind->_nativePtr), paths, moveFiles);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...)
+        {
+            throw gcnew Exception("An unexpected error occurred during Ingest() into: "
+                + kind->Name);
+        }
+    }
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+    NativeBytes^ KeyValueStore::UpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    {
+        return UpdateIfPresent(kind, key, value, DefaultWriteOptions);
+    }
+
+    NativeBytes^ KeyValueStore::UpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value,
+        WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        // Create initially empty string_views
+        std::string_view nativeKeyView;
+        std::string_view nativeValueView;
+
+        // The pin_ptr's must be declared here at method scope level!
+        // (Otherwise the .NET GC could move the underlying memory
+        // while we are still using the pointers!)
+        pin_ptr<const Byte> pKey;
+        pin_ptr<const Byte> pValue;
+
+        // Pin the managed spans to get a stable pointer for the
+        // duration of the use of the string_views.
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (value.Length > 0) {
+            pValue = &MemoryMarshal::GetReference(value);
+            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
+        }
+
+        try {
+            // (If Length was 0 the empty string_view from above gets passed)
+            bytes result = _nativePtr->updateIfPresent(*(kind->_nativePtr), nativeKeyView, nativeValueView,
+                options->ToNative());
+            if (_perfSampling) RecordPerfSample("UpdateIfPresent");
+
+            if (!result) return nullptr;
+            // std::move casts the l-value 'result' into a r-value so that the
+            // cheap move constructors can be used (only a pointer and length swap).
+            return gcnew NativeBytes(std::move(result));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during UpdateIfPresent() operation.");
+        }
+    }
+
+    bool KeyValueStore::PutIfAbsent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    {
+        return PutIfAbsent(kind, key, value, DefaultWriteOptions);
+    }
+
+    bool KeyValueStore::PutIfAbsent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeKeyView;
+        std::string_view nativeValueView;
+
+        pin_ptr<const Byte> pKey;
+        pin_ptr<const Byte> pValue;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (value.Length > 0) {
+            pValue = &MemoryMarshal::GetReference(value);
+            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
+        }
+
+        try {
+            bool added = _nativePtr->putIfAbsent(*(kind->_nativePtr), nativeKeyView, nativeValueView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("PutIfAbsent");
+            return added;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during PutIfAbsent() operation.");
+        }
+    }
+
+    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    {
+        Put(kind, key, value, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeKeyView;
+        std::string_view nativeValueView;
+
+        pin_ptr<const Byte> pKey;
+        pin_ptr<const Byte> pValue;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (value.Length > 0) {
+            pValue = &MemoryMarshal::GetReference(value);
+            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
+        }
+
+        try {
+            _nativePtr->put(*(kind->_nativePtr), nativeKeyView, nativeValueView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("Put");
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Put() operation.");
+        }
+    }
+
+    // Returns false instead of blocking the caller if writes are currently stalled
+    bool KeyValueStore::TryPut(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    {
+        return TryPut(kind, key, value, DefaultWriteOptions);
+    }
+
+    bool KeyValueStore::TryPut(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeKeyView;
+        std::string_view nativeValueView;
+
+        pin_ptr<const Byte> pKey;
+        pin_ptr<const Byte> pValue;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (value.Length > 0) {
+            pValue = &MemoryMarshal::GetReference(value);
+            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
+        }
+
+        try {
+            bool written = _nativePtr->tryPut(*(kind->_nativePtr), nativeKeyView, nativeValueView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("TryPut");
+            return written;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during TryPut() operation.");
+        }
+    }
+
+    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, TimeSpan timeToLive)
+    {
+        Put(kind, key, value, timeToLive, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, TimeSpan timeToLive,
+        WriteOptions^ options)
+    {
+        if (timeToLive <= TimeSpan::Zero) throw gcnew ArgumentOutOfRangeException("timeToLive");
+        Put(kind, key, value, DateTimeOffset::UtcNow + timeToLive, options);
+    }
+
+    // Requires a Kind that has been created with KindOptions::PerEntryExpiry
+    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, DateTimeOffset expiresAt)
+    {
+        Put(kind, key, value, expiresAt, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, DateTimeOffset expiresAt,
+        WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeKeyView;
+        std::string_view nativeValueView;
+
+        pin_ptr<const Byte> pKey;
+        pin_ptr<const Byte> pValue;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (value.Length > 0) {
+            pValue = &MemoryMarshal::GetReference(value);
+            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
+        }
+
+        try {
+            std::chrono::system_clock::time_point nativeExpiresAt{
+                std::chrono::milliseconds(expiresAt.ToUnixTimeMilliseconds()) };
+            _nativePtr->putWithExpiry(*(kind->_nativePtr), nativeKeyView, nativeValueView, nativeExpiresAt,
+                options->ToNative());
+            if (_perfSampling) RecordPerfSample("Put");
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Put() operation.");
+        }
+    }
+
+    NativeBytes^ KeyValueStore::Get(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+
+        std::string_view nativeKeyView;
+        pin_ptr<const Byte> pKey;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        try {
+            bytes result = _nativePtr->get(*(kind->_nativePtr), nativeKeyView);
+            if (_perfSampling) RecordPerfSample("Get");
+            if (!result) return nullptr;
+            return gcnew NativeBytes(std::move(result));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Get() operation.");
+        }
+    }
+
+    NativeBytes^ KeyValueStore::Get(Kind^ kind, ReadOnlySpan<Byte> key, Snapshot^ snapshot)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (snapshot == nullptr) throw gcnew ArgumentNullException("snapshot");
+        ThrowIfForeign(snapshot);
+
+        std::string_view nativeKeyView;
+        pin_ptr<const Byte> pKey;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        try {
+            bytes result = _nativePtr->get(*(kind->_nativePtr), nativeKeyView, *(snapshot->_nativePtr));
+            if (_perfSampling) RecordPerfSample("Get");
+            if (!result) return nullptr;
+            return gcnew NativeBytes(std::move(result));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Get() operation.");
+        }
+    }
+
+    NativeBytes^ KeyValueStore::Get(Kind^ kind, ReadOnlySpan<Byte> key, ReadOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeKeyView;
+        pin_ptr<const Byte> pKey;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        try {
+            bytes result = _nativePtr->get(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("Get");
+            if (!result) return nullptr;
+            return gcnew NativeBytes(std::move(result));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Get() operation.");
+        }
+    }
+
+    NativeBytes^ KeyValueStore::Get(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, int length)
+    {
+        return Get(kind, key, offset, length, DefaultReadOptions);
+    }
+
+    NativeBytes^ KeyValueStore::Get(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, int length, ReadOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (offset < 0) throw gcnew ArgumentOutOfRangeException("offset");
+        if (length < 0) throw gcnew ArgumentOutOfRangeException("length");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeKeyView;
+        pin_ptr<const Byte> pKey;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        try {
+            bytes result = _nativePtr->get(*(kind->_nativePtr), nativeKeyView, static_cast<size_t>(offset),
+                static_cast<size_t>(length), options->ToNative());
+            if (_perfSampling) RecordPerfSample("Get");
+            if (!result) return nullptr;
+            return gcnew NativeBytes(std::move(result));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during Get() operation.");
+        }
+    }
+
+    // internal
+    int KeyValueStore::ReadRange(Kind^ kind, ReadOnlySpan<Byte> key, Snapshot^ snapshot, ReadOptions^ options,
+        Int64 offset, Span<Byte> dest, Int64% valueSize)
+    {
+        ThrowIfDisposed();
+        if (snapshot != nullptr) ThrowIfForeign(snapshot);
+
+        std::string_view nativeKeyView;
+        pin_ptr<const Byte> pKey;
+        pin_ptr<Byte> pDest;
+        char* nativeDest = nullptr;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (dest.Length > 0) {
+            pDest = &MemoryMarshal::GetReference(dest);
+            nativeDest = reinterpret_cast<char*>(pDest);
+        }
+
+        try {
+            size_t totalLen = 0;
+            const ::Snapshot* pSnapshot = snapshot != nullptr ? snapshot->_nativePtr : nullptr;
+            std::optional<size_t> copied = _nativePtr->read(*(kind->_nativePtr), nativeKeyView,
+                static_cast<size_t>(offset), nativeDest, static_cast<size_t>(dest.Length), &totalLen, pSnapshot,
+                options->ToNative());
+            if (_perfSampling) RecordPerfSample("Read");
+            if (!copied) return -1;
+            valueSize = static_cast<Int64>(totalLen);
+            return static_cast<int>(*copied);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during a ranged read.");
+        }
+    }
+
+    ValueReadStream^ KeyValueStore::OpenValueReadStream(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        return OpenValueReadStream(kind, key, DefaultReadOptions);
+    }
+
+    ValueReadStream^ KeyValueStore::OpenValueReadStream(Kind^ kind, ReadOnlySpan<Byte> key, ReadOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        Snapshot^ snapshot = GetSnapshot();
+        try {
+            Int64 valueSize = 0;
+            if (ReadRange(kind, key, snapshot, options, 0, Span<Byte>(), valueSize) < 0) {
+                delete snapshot;
+                return nullptr;
+            }
+            // the stream takes over ownership of the snapshot
+            return gcnew ValueReadStream(this, kind, key.ToArray(), snapshot, options, valueSize);
         }
-        catch (RocksDbException^) {
+        catch (...) {
+            delete snapshot;
             throw;
         }
-        catch (...)
-        {
-            throw gcnew Exception("An unexpected error occurred during CompactAll() compaction.");
-        }
     }
 
-#pragma warning(push)
-#pragma warning(disable:4996)
+    ValueWriteStream^ KeyValueStore::OpenValueWriteStream(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        return OpenValueWriteStream(kind, key, 0);
+    }
 
-    NativeBytes^ KeyValueStore::UpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    ValueWriteStream^ KeyValueStore::OpenValueWriteStream(Kind^ kind, ReadOnlySpan<Byte> key, Int64 expectedSize)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (expectedSize < 0) throw gcnew ArgumentOutOfRangeException("expectedSize");
 
-        // Create initially empty string_views
         std::string_view nativeKeyView;
-        std::string_view nativeValueView;
-
-        // The pin_ptr's must be declared here at method scope level!
-        // (Otherwise the .NET GC could move the underlying memory
-        // while we are still using the pointers!)
         pin_ptr<const Byte> pKey;
-        pin_ptr<const Byte> pValue;
 
-        // Pin the managed spans to get a stable pointer for the
-        // duration of the use of the string_views.
         if (key.Length > 0) {
             pKey = &MemoryMarshal::GetReference(key);
             nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
         }
 
-        if (value.Length > 0) {
-            pValue = &MemoryMarshal::GetReference(value);
-            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
-        }
-
         try {
-            // (If Length was 0 the empty string_view from above gets passed)
-            bytes result = _nativePtr->updateIfPresent(*(kind->_nativePtr), nativeKeyView, nativeValueView);
-
-            if (!result) return nullptr;
-            // std::move casts the l-value 'result' into a r-value so that the
-            // cheap move constructors can be used (only a pointer and length swap).
-            return gcnew NativeBytes(std::move(result));
+            // the native writer keeps its own copy of the key
+            ValueWriter* nativeWriter = _nativePtr->createValueWriter(*(kind->_nativePtr), nativeKeyView,
+                static_cast<size_t>(expectedSize));
+            return gcnew ValueWriteStream(this, nativeWriter);
         }
         catch (RocksDbException^) {
             throw;
         }
         catch (...) {
-            throw gcnew Exception("An unexpected error occurred during UpdateIfPresent() operation.");
+            throw gcnew Exception("An unexpected error occurred while opening a ValueWriteStream.");
         }
     }
 
-    bool KeyValueStore::PutIfAbsent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    bool KeyValueStore::Contains(Kind^ kind, ReadOnlySpan<Byte> key)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
 
         std::string_view nativeKeyView;
-        std::string_view nativeValueView;
-
         pin_ptr<const Byte> pKey;
-        pin_ptr<const Byte> pValue;
 
         if (key.Length > 0) {
             pKey = &MemoryMarshal::GetReference(key);
             nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
         }
 
-        if (value.Length > 0) {
-            pValue = &MemoryMarshal::GetReference(value);
-            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
-        }
-
         try {
-            return _nativePtr->putIfAbsent(*(kind->_nativePtr), nativeKeyView, nativeValueView);
+            bool found = _nativePtr->contains(*(kind->_nativePtr), nativeKeyView);
+            if (_perfSampling) RecordPerfSample("Contains");
+            return found;
         }
         catch (RocksDbException^) {
             throw;
         }
         catch (...) {
-            throw gcnew Exception("An unexpected error occurred during PutIfAbsent() operation.");
+            throw gcnew Exception("An unexpected error occurred during Contains() operation.");
         }
     }
 
-    void KeyValueStore::Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    bool KeyValueStore::TryGetValueSize(Kind^ kind, ReadOnlySpan<Byte> key, Int64% valueSize)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
 
         std::string_view nativeKeyView;
-        std::string_view nativeValueView;
-
         pin_ptr<const Byte> pKey;
-        pin_ptr<const Byte> pValue;
 
         if (key.Length > 0) {
             pKey = &MemoryMarshal::GetReference(key);
             nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
         }
 
-        if (value.Length > 0) {
-            pValue = &MemoryMarshal::GetReference(value);
-            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
-        }
-
         try {
-            _nativePtr->put(*(kind->_nativePtr), nativeKeyView, nativeValueView);
+            std::optional<size_t> size = _nativePtr->valueSize(*(kind->_nativePtr), nativeKeyView);
+            if (_perfSampling) RecordPerfSample("TryGetValueSize");
+            if (!size) return false;
+            valueSize = static_cast<Int64>(*size);
+            return true;
         }
         catch (RocksDbException^) {
             throw;
         }
         catch (...) {
-            throw gcnew Exception("An unexpected error occurred during Put() operation.");
+            throw gcnew Exception("An unexpected error occurred during TryGetValueSize() operation.");
         }
     }
 
-    NativeBytes^ KeyValueStore::Get(Kind^ kind, ReadOnlySpan<Byte> key)
+    IReadOnlyList<NativeBytes^>^ KeyValueStore::MultiGet(Kind^ kind, IReadOnlyList<array<Byte>^>^ keys)
     {
-        ThrowIfDisposed();
-        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        return MultiGet(kind, keys, nullptr);
+    }
 
-        std::string_view nativeKeyView;
-        pin_ptr<const Byte> pKey;
+    IReadOnlyList<NativeBytes^>^ KeyValueStore::MultiGet(Kind^ kind, IReadOnlyList<array<Byte>^>^ keys, Snapshot^ snapshot)
+    {
+        return MultiGet(kind, keys, snapshot, DefaultReadOptions);
+    }
 
-        if (key.Length > 0) {
-            pKey = &MemoryMarshal::GetReference(key);
-            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+    IReadOnlyList<NativeBytes^>^ KeyValueStore::MultiGet(Kind^ kind, IReadOnlyList<array<Byte>^>^ keys, Snapshot^ snapshot,
+        ReadOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (keys == nullptr) throw gcnew ArgumentNullException("keys");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+        if (snapshot != nullptr) ThrowIfForeign(snapshot);
+
+        // Keys are copied into native memory once, so that we don't
+        // have to keep an arbitrary number of managed arrays pinned.
+        std::vector<std::string> nativeKeys;
+        nativeKeys.reserve(keys->Count);
+        for (int i = 0; i < keys->Count; ++i) {
+            array<Byte>^ key = keys[i];
+            if (key == nullptr) throw gcnew ArgumentNullException("keys[" + i + "]");
+            if (key->Length > 0) {
+                pin_ptr<const Byte> pKey = &key[0];
+                nativeKeys.emplace_back(reinterpret_cast<const char*>(pKey), key->Length);
+            }
+            else {
+                nativeKeys.emplace_back();
+            }
         }
+        std::vector<std::string_view> nativeKeyViews(nativeKeys.begin(), nativeKeys.end());
 
         try {
-            bytes result = _nativePtr->get(*(kind->_nativePtr), nativeKeyView);
-            if (!result) return nullptr;
-            return gcnew NativeBytes(std::move(result));
+            const ::Snapshot* pSnapshot = snapshot != nullptr ? snapshot->_nativePtr : nullptr;
+            std::vector<bytes> results = _nativePtr->multiGet(*(kind->_nativePtr), nativeKeyViews, pSnapshot,
+                options->ToNative());
+            if (_perfSampling) RecordPerfSample("MultiGet");
+            List<NativeBytes^>^ managedList = gcnew List<NativeBytes^>((int)results.size());
+            for (bytes& result : results) {
+                managedList->Add(result ? gcnew NativeBytes(std::move(result)) : nullptr);
+            }
+            return managedList->AsReadOnly();
         }
         catch (RocksDbException^) {
             throw;
         }
         catch (...) {
-            throw gcnew Exception("An unexpected error occurred during Get() operation.");
+            throw gcnew Exception("An unexpected error occurred during MultiGet() operation.");
         }
     }
 
     NativeBytes^ KeyValueStore::SingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        return SingleRemoveIfPresent(kind, key, DefaultWriteOptions);
+    }
+
+    NativeBytes^ KeyValueStore::SingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         pin_ptr<const Byte> pKey;
@@ -282,7 +1129,8 @@ namespace librocks::Net {
         }
 
         try {
-            bytes result = _nativePtr->singleRemoveIfPresent(*(kind->_nativePtr), nativeKeyView);
+            bytes result = _nativePtr->singleRemoveIfPresent(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("SingleRemoveIfPresent");
             if (!result) return nullptr;
             return gcnew NativeBytes(std::move(result));
         }
@@ -295,9 +1143,15 @@ namespace librocks::Net {
     }
 
     NativeBytes^ KeyValueStore::RemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        return RemoveIfPresent(kind, key, DefaultWriteOptions);
+    }
+
+    NativeBytes^ KeyValueStore::RemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         pin_ptr<const Byte> pKey;
@@ -308,7 +1162,8 @@ namespace librocks::Net {
         }
 
         try {
-            bytes result = _nativePtr->removeIfPresent(*(kind->_nativePtr), nativeKeyView);
+            bytes result = _nativePtr->removeIfPresent(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("RemoveIfPresent");
             if (!result) return nullptr;
             return gcnew NativeBytes(std::move(result));
         }
@@ -321,9 +1176,15 @@ namespace librocks::Net {
     }
 
     void KeyValueStore::SingleRemove(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        SingleRemove(kind, key, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::SingleRemove(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         pin_ptr<const Byte> pKey;
@@ -334,7 +1195,8 @@ namespace librocks::Net {
         }
 
         try {
-            _nativePtr->singleRemove(*(kind->_nativePtr), nativeKeyView);
+            _nativePtr->singleRemove(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("SingleRemove");
         }
         catch (RocksDbException^) {
             throw;
@@ -345,9 +1207,15 @@ namespace librocks::Net {
     }
 
     void KeyValueStore::Remove(Kind^ kind, ReadOnlySpan<Byte> key)
+    {
+        Remove(kind, key, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::Remove(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         pin_ptr<const Byte> pKey;
@@ -358,7 +1226,8 @@ namespace librocks::Net {
         }
 
         try {
-            _nativePtr->remove(*(kind->_nativePtr), nativeKeyView);
+            _nativePtr->remove(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("Remove");
         }
         catch (RocksDbException^) {
             throw;
@@ -369,12 +1238,19 @@ namespace librocks::Net {
     }
 
     NativeBytes^ KeyValueStore::FindMinKey(Kind^ kind)
+    {
+        return FindMinKey(kind, DefaultReadOptions);
+    }
+
+    NativeBytes^ KeyValueStore::FindMinKey(Kind^ kind, ReadOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         try {
-            bytes result = _nativePtr->findMinKey(*(kind->_nativePtr));
+            bytes result = _nativePtr->findMinKey(*(kind->_nativePtr), options->ToNative());
+            if (_perfSampling) RecordPerfSample("FindMinKey");
             if (!result) return nullptr;
             return gcnew NativeBytes(std::move(result));
         }
@@ -387,12 +1263,19 @@ namespace librocks::Net {
     }
 
     NativeBytes^ KeyValueStore::FindMaxKey(Kind^ kind)
+    {
+        return FindMaxKey(kind, DefaultReadOptions);
+    }
+
+    NativeBytes^ KeyValueStore::FindMaxKey(Kind^ kind, ReadOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         try {
-            bytes result = _nativePtr->findMaxKey(*(kind->_nativePtr));
+            bytes result = _nativePtr->findMaxKey(*(kind->_nativePtr), options->ToNative());
+            if (_perfSampling) RecordPerfSample("FindMaxKey");
             if (!result) return nullptr;
             return gcnew NativeBytes(std::move(result));
         }
@@ -404,10 +1287,258 @@ namespace librocks::Net {
         }
     }
 
+    void KeyValueStore::RemoveRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive)
+    {
+        RemoveRange(kind, beginKeyInclusive, endKeyExclusive, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::RemoveRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        WriteOptions^ options)
+    {
+        ThrowIfEmptyEnd(endKeyExclusive);
+        DoRemoveRange(kind, beginKeyInclusive, endKeyExclusive, false, options);
+    }
+
+    void KeyValueStore::RemoveRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive)
+    {
+        RemoveRangeFrom(kind, beginKeyInclusive, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::RemoveRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, WriteOptions^ options)
+    {
+        DoRemoveRange(kind, beginKeyInclusive, ReadOnlySpan<Byte>(), true, options);
+    }
+
+    // An empty beginKeyInclusive is passed as nullptr (unbounded), which is the same
+    // as the empty key, endKeyExclusive only if unboundedEnd is set
+    void KeyValueStore::DoRemoveRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        bool unboundedEnd, WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeBeginView;
+        std::string_view nativeEndView;
+
+        pin_ptr<const Byte> pBegin;
+        pin_ptr<const Byte> pEnd;
+
+        if (beginKeyInclusive.Length > 0) {
+            pBegin = &MemoryMarshal::GetReference(beginKeyInclusive);
+            nativeBeginView = std::string_view(reinterpret_cast<const char*>(pBegin), beginKeyInclusive.Length);
+        }
+
+        if (!unboundedEnd) {
+            pEnd = &MemoryMarshal::GetReference(endKeyExclusive);
+            nativeEndView = std::string_view(reinterpret_cast<const char*>(pEnd), endKeyExclusive.Length);
+        }
+
+        try {
+            _nativePtr->removeRange(*(kind->_nativePtr), nativeBeginView, nativeEndView, options->ToNative());
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during RemoveRange() operation.");
+        }
+    }
+
+    void KeyValueStore::PurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive)
+    {
+        PurgeRange(kind, beginKeyInclusive, endKeyExclusive, false);
+    }
+
+    void KeyValueStore::PurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        bool compactBoundaries)
+    {
+        PurgeRange(kind, beginKeyInclusive, endKeyExclusive, compactBoundaries, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::PurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        bool compactBoundaries, WriteOptions^ options)
+    {
+        ThrowIfEmptyEnd(endKeyExclusive);
+        DoPurgeRange(kind, beginKeyInclusive, endKeyExclusive, false, compactBoundaries, options);
+    }
+
+    void KeyValueStore::PurgeRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive)
+    {
+        PurgeRangeFrom(kind, beginKeyInclusive, false, DefaultWriteOptions);
+    }
+
+    void KeyValueStore::PurgeRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, bool compactBoundaries,
+        WriteOptions^ options)
+    {
+        DoPurgeRange(kind, beginKeyInclusive, ReadOnlySpan<Byte>(), true, compactBoundaries, options);
+    }
+
+    void KeyValueStore::DoPurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        bool unboundedEnd, bool compactBoundaries, WriteOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        std::string_view nativeBeginView;
+        std::string_view nativeEndView;
+
+        pin_ptr<const Byte> pBegin;
+        pin_ptr<const Byte> pEnd;
+
+        if (beginKeyInclusive.Length > 0) {
+            pBegin = &MemoryMarshal::GetReference(beginKeyInclusive);
+            nativeBeginView = std::string_view(reinterpret_cast<const char*>(pBegin), beginKeyInclusive.Length);
+        }
+
+        if (!unboundedEnd) {
+            pEnd = &MemoryMarshal::GetReference(endKeyExclusive);
+            nativeEndView = std::string_view(reinterpret_cast<const char*>(pEnd), endKeyExclusive.Length);
+        }
+
+        try {
+            _nativePtr->purgeRange(*(kind->_nativePtr), nativeBeginView, nativeEndView, compactBoundaries,
+                options->ToNative());
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during PurgeRange() operation.");
+        }
+    }
+
+    UInt64 KeyValueStore::ApproximateSize(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive)
+    {
+        UInt64 onDiskBytes = 0;
+        UInt64 memtableBytes = 0;
+        ApproximateSize(kind, beginKeyInclusive, endKeyExclusive, onDiskBytes, memtableBytes);
+        return onDiskBytes + memtableBytes;
+    }
+
+    void KeyValueStore::ApproximateSize(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+        UInt64% onDiskBytes, UInt64% memtableBytes)
+    {
+        ThrowIfEmptyEnd(endKeyExclusive);
+        DoApproximateSize(kind, beginKeyInclusive, endKeyExclusive, false, onDiskBytes, memtableBytes);
+    }
+
+    UInt64 KeyValueStore::ApproximateSizeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive)
+    {
+        UInt64 onDiskBytes = 0;
+        UInt64 memtableBytes = 0;
+        DoApproximateSize(kind, beginKeyInclusive, ReadOnlySpan<Byte>(), true, onDiskBytes, memtableBytes);
+        return onDiskBytes + memtableBytes;
+    }
+
+    void KeyValueStore::DoApproximateSize(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive,
+        ReadOnlySpan<Byte> endKeyExclusive, bool unboundedEnd, UInt64% onDiskBytes, UInt64% memtableBytes)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+
+        std::string_view nativeBeginView;
+        std::string_view nativeEndView;
+
+        pin_ptr<const Byte> pBegin;
+        pin_ptr<const Byte> pEnd;
+
+        if (beginKeyInclusive.Length > 0) {
+            pBegin = &MemoryMarshal::GetReference(beginKeyInclusive);
+            nativeBeginView = std::string_view(reinterpret_cast<const char*>(pBegin), beginKeyInclusive.Length);
+        }
+
+        if (!unboundedEnd) {
+            pEnd = &MemoryMarshal::GetReference(endKeyExclusive);
+            nativeEndView = std::string_view(reinterpret_cast<const char*>(pEnd), endKeyExclusive.Length);
+        }
+
+        try {
+            unsigned long long nativeOnDisk = 0;
+            unsigned long long nativeMemtable = 0;
+            _nativePtr->approximateSize(*(kind->_nativePtr), nativeBeginView, nativeEndView, nativeOnDisk, nativeMemtable);
+            onDiskBytes = nativeOnDisk;
+            memtableBytes = nativeMemtable;
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during ApproximateSize() operation.");
+        }
+    }
+
+    UInt64 KeyValueStore::EstimateNumKeys(Kind^ kind)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+
+        try {
+            return _nativePtr->estimateNumKeys(*(kind->_nativePtr));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during EstimateNumKeys() operation.");
+        }
+    }
+
+    BlobStats KeyValueStore::GetBlobStats(Kind^ kind)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+
+        try {
+            return BlobStats(_nativePtr->getBlobStats(*(kind->_nativePtr)));
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during GetBlobStats() operation.");
+        }
+    }
+
+    MemoryUsage KeyValueStore::GetMemoryUsage()
+    {
+        ThrowIfDisposed();
+
+        try {
+            return MemoryUsage(_nativePtr->memoryUsage());
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during GetMemoryUsage() operation.");
+        }
+    }
+
+    RecoveryReport KeyValueStore::GetRecoveryReport()
+    {
+        ThrowIfDisposed();
+
+        try {
+            return RecoveryReport(_nativePtr->recoveryReport());
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during GetRecoveryReport() operation.");
+        }
+    }
+
     bool KeyValueStore::TryUpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, Span<Byte> dest, int% bytesWritten)
+    {
+        return TryUpdateIfPresent(kind, key, value, dest, bytesWritten, DefaultWriteOptions);
+    }
+
+    bool KeyValueStore::TryUpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, Span<Byte> dest, int% bytesWritten,
+        WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         std::string_view nativeValueView;
@@ -426,7 +1557,9 @@ namespace librocks::Net {
         }
 
         try {
-            bytes result = _nativePtr->updateIfPresent(*(kind->_nativePtr), nativeKeyView, nativeValueView);
+            bytes result = _nativePtr->updateIfPresent(*(kind->_nativePtr), nativeKeyView, nativeValueView,
+                options->ToNative());
+            if (_perfSampling) RecordPerfSample("TryUpdateIfPresent");
 
             if (!result) return false;
             // Check target span size
@@ -466,6 +1599,7 @@ namespace librocks::Net {
 
         try {
             bytes result = _nativePtr->get(*(kind->_nativePtr), nativeKeyView);
+            if (_perfSampling) RecordPerfSample("TryGet");
 
             if (!result) return false;
             int resultSize = static_cast<int>(result.size());
@@ -487,10 +1621,38 @@ namespace librocks::Net {
         }
     }
 
+    bool KeyValueStore::TryGet(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, Span<Byte> dest, int% bytesWritten)
+    {
+        return TryGet(kind, key, offset, dest, bytesWritten, DefaultReadOptions);
+    }
+
+    bool KeyValueStore::TryGet(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, Span<Byte> dest, int% bytesWritten,
+        ReadOptions^ options)
+    {
+        ThrowIfDisposed();
+        if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (offset < 0) throw gcnew ArgumentOutOfRangeException("offset");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
+
+        Int64 valueSize = 0;
+        int resultSize = ReadRange(kind, key, nullptr, options, offset, dest, valueSize);
+        if (resultSize < 0) return false;
+
+        bytesWritten = resultSize;
+        return true;
+    }
+
     bool KeyValueStore::TrySingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, int% bytesWritten)
+    {
+        return TrySingleRemoveIfPresent(kind, key, dest, bytesWritten, DefaultWriteOptions);
+    }
+
+    bool KeyValueStore::TrySingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, int% bytesWritten,
+        WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         pin_ptr<const Byte> pKey;
@@ -501,7 +1663,8 @@ namespace librocks::Net {
         }
 
         try {
-            bytes result = _nativePtr->singleRemoveIfPresent(*(kind->_nativePtr), nativeKeyView);
+            bytes result = _nativePtr->singleRemoveIfPresent(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("TrySingleRemoveIfPresent");
 
             if (!result) return false;
             int resultSize = static_cast<int>(result.size());
@@ -524,9 +1687,16 @@ namespace librocks::Net {
     }
 
     bool KeyValueStore::TryRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, int% bytesWritten)
+    {
+        return TryRemoveIfPresent(kind, key, dest, bytesWritten, DefaultWriteOptions);
+    }
+
+    bool KeyValueStore::TryRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, int% bytesWritten,
+        WriteOptions^ options)
     {
         ThrowIfDisposed();
         if (kind == nullptr) throw gcnew ArgumentNullException("kind");
+        if (options == nullptr) throw gcnew ArgumentNullException("options");
 
         std::string_view nativeKeyView;
         pin_ptr<const Byte> pKey;
@@ -537,7 +1707,8 @@ namespace librocks::Net {
         }
 
         try {
-            bytes result = _nativePtr->removeIfPresent(*(kind->_nativePtr), nativeKeyView);
+            bytes result = _nativePtr->removeIfPresent(*(kind->_nativePtr), nativeKeyView, options->ToNative());
+            if (_perfSampling) RecordPerfSample("TryRemoveIfPresent");
 
             if (!result) return false;
             int resultSize = static_cast<int>(result.size());
@@ -566,6 +1737,7 @@ namespace librocks::Net {
 
         try {
             bytes result = _nativePtr->findMinKey(*(kind->_nativePtr));
+            if (_perfSampling) RecordPerfSample("TryFindMinKey");
 
             if (!result) return false;
             int resultSize = static_cast<int>(result.size());
@@ -594,6 +1766,7 @@ namespace librocks::Net {
 
         try {
             bytes result = _nativePtr->findMaxKey(*(kind->_nativePtr));
+            if (_perfSampling) RecordPerfSample("TryFindMaxKey");
 
             if (!result) return false;
             int resultSize = static_cast<int>(result.size());
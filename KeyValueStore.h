@@ -20,7 +20,26 @@
 #include <msclr/marshal_cppstd.h>
 #include "RocksDbException.h"
 #include "Kind.h"
+#include "KindOptions.h"
+#include "BackupInfo.h"
+#include "BlobStats.h"
+#include "MemoryUsage.h"
+#include "RecoveryReport.h"
+#include "HotKeyStats.h"
+#include "TraceReplayReport.h"
+#include "KeyValueStoreOptions.h"
+#include "ReadCacheStats.h"
+#include "RetentionRules.h"
+#include "RateLimits.h"
+#include "ReadOptions.h"
+#include "WriteOptions.h"
 #include "NativeBytes.h"
+#include "Snapshot.h"
+#include "ChangeFeed.h"
+#include "CompactionJob.h"
+#include "SstWriter.h"
+#include "ValueReadStream.h"
+#include "ValueWriteStream.h"
 
 namespace marshal = msclr::interop;
 
@@ -34,20 +53,46 @@ namespace librocks::Net {
     public ref class KeyValueStore
     {
         public:
+            // Name of the ActivitySource that reports sampled perf contexts (see KeyValueStoreOptions::PerfSampleInterval)
+            literal String^ ActivitySourceName = "librocks.Net";
+
             KeyValueStore(String^ path) {
                 if (path == nullptr) throw gcnew ArgumentNullException("path");
-                std::string dbPath { marshal::marshal_as<std::string>(path) };
-                try {
-                    _nativePtr = new KVStore(dbPath);
-                }
-                catch (RocksDbException^) {
-                    _nativePtr = nullptr;
-                    throw;
-                }
-                catch (...) {
-                    _nativePtr = nullptr;
-                    throw gcnew Exception("An unknown error occurred during KeyValueStore initialization.");
-                }
+                Open(path, ::KVStoreOptions());
+            }
+
+            KeyValueStore(String^ path, KeyValueStoreOptions^ options) {
+                if (path == nullptr) throw gcnew ArgumentNullException("path");
+                if (options == nullptr) throw gcnew ArgumentNullException("options");
+                Open(path, options->ToNative());
+            }
+
+            // Opens the store for reading while another process may be writing to it, see OpenMode::ReadOnly
+            static KeyValueStore^ OpenReadOnly(String^ path) {
+                return OpenReadOnly(path, gcnew KeyValueStoreOptions());
+            }
+
+            static KeyValueStore^ OpenReadOnly(String^ path, KeyValueStoreOptions^ options) {
+                if (path == nullptr) throw gcnew ArgumentNullException("path");
+                if (options == nullptr) throw gcnew ArgumentNullException("options");
+                ::KVStoreOptions nativeOptions = options->ToNative();
+                nativeOptions.openMode = ::OpenMode::ReadOnly;
+                return gcnew KeyValueStore(path, nativeOptions);
+            }
+
+            // Use TryCatchUpWithPrimary() to pick up the primary's newer writes, see OpenMode::Secondary
+            static KeyValueStore^ OpenSecondary(String^ path, String^ secondaryPath) {
+                return OpenSecondary(path, secondaryPath, gcnew KeyValueStoreOptions());
+            }
+
+            static KeyValueStore^ OpenSecondary(String^ path, String^ secondaryPath, KeyValueStoreOptions^ options) {
+                if (path == nullptr) throw gcnew ArgumentNullException("path");
+                if (secondaryPath == nullptr) throw gcnew ArgumentNullException("secondaryPath");
+                if (options == nullptr) throw gcnew ArgumentNullException("options");
+                ::KVStoreOptions nativeOptions = options->ToNative();
+                nativeOptions.openMode = ::OpenMode::Secondary;
+                nativeOptions.secondaryPath = marshal::marshal_as<std::string>(secondaryPath);
+                return gcnew KeyValueStore(path, nativeOptions);
             }
 
             // Inherited via IDisposable
@@ -61,6 +106,7 @@ namespace librocks::Net {
                         _kindCache->Clear();
                         _kindCache = nullptr;
                     }
+                    DisposeDependents();
                     delete _nativePtr;
                     _nativePtr = nullptr;
                 }
@@ -77,57 +123,357 @@ namespace librocks::Net {
                 }
             }
 
+            // Restores the latest backup in backupDir into restoreDir, which must not hold an open store
+            static void RestoreBackup(String^ backupDir, String^ restoreDir);
+
+            static void RestoreBackup(String^ backupDir, String^ restoreDir, UInt32 backupId);
+
+            // Deletes all but the numToKeep latest backups in backupDir
+            static void PurgeOldBackups(String^ backupDir, UInt32 numToKeep);
+
+            // Re-executes a trace recorded with KeyValueStoreOptions::TraceFile against a new store at storePath,
+            // which must not exist yet.
+            // A speedup of 1.0 keeps the original pacing, 0 replays as fast as possible.
+            static TraceReplayReport ReplayTrace(String^ tracePath, String^ storePath, double speedup);
+
             // starting here each method needs to call ThrowIfDisposed!
 
+            property bool IsReadOnly {
+                bool get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->isReadOnly();
+                }
+            }
+
+            // Only for stores opened with OpenMode::Secondary
+            void TryCatchUpWithPrimary();
+
             Kind^ GetDefaultKind();
 
             Kind^ GetOrCreateKind(String^ kindName);
 
+            Kind^ GetOrCreateKind(String^ kindName, KindOptions^ options);
+
             IReadOnlyCollection<Kind^>^ GetKinds();
 
+            KindOptions^ GetKindOptions(Kind^ kind);
+
             void Compact(Kind^ kind);
 
             void CompactAll();
 
+            void SetRateLimits(RateLimits^ limits);
+
+            RateLimits^ GetRateLimits();
+
+            void SetCompactionFilter(Kind^ kind, RetentionRules^ rules);
+
+            void ClearCompactionFilter(Kind^ kind);
+
+            ReadCacheStats GetReadCacheStats();
+
+            property UInt64 CoalescedReadCount {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->getCoalescedReadCount();
+                }
+            }
+
+            // The hottest keys per Kind since the last ResetHotKeys(), empty unless
+            // KeyValueStoreOptions::HotKeySampleInterval is set
+            IReadOnlyList<HotKeyStats^>^ GetHotKeys();
+
+            void ResetHotKeys();
+
+            // Trace records dropped because the trace couldn't be written out fast enough
+            property UInt64 DroppedTraceRecordCount {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->getDroppedTraceRecords();
+                }
+            }
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+            CompactionJob^ CompactRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive);
+
+            CompactionJob^ CompactRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                int targetLevel, int maxSubcompactions);
+
+#pragma warning(pop)
+
+            Snapshot^ GetSnapshot();
+
+            // Creates an openable copy of the store in dir (which must not exist yet) without blocking writes.
+            // The table files are hard-linked, so this takes well under a second regardless of the store's size.
+            void CreateCheckpoint(String^ dir);
+
+            // Adds an incremental backup to backupDir that only copies the table files earlier backups don't contain
+            BackupInfo CreateBackup(String^ backupDir);
+
+            BackupInfo CreateBackup(String^ backupDir, bool flushBeforeBackup);
+
+            // Sequence number of the last committed write
+            property UInt64 LatestSequenceNumber {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->latestSequenceNumber();
+                }
+            }
+
+            // Tails the WAL from fromSequenceNumber, LatestSequenceNumber + 1 only returns the writes from now on.
+            // Older positions require KeyValueStoreOptions::WalRetention to keep the WAL files around.
+            ChangeFeed^ OpenChangeFeed(UInt64 fromSequenceNumber);
+
+            SstWriter^ CreateSstWriter(Kind^ kind);
+
+            void Ingest(Kind^ kind, IEnumerable<String^>^ filePaths);
+
+            void Ingest(Kind^ kind, IEnumerable<String^>^ filePaths, bool moveFiles);
+
 #pragma warning(push)
 #pragma warning(disable:4996)
 
             NativeBytes^ UpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value);
 
+            NativeBytes^ UpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options);
+
             bool PutIfAbsent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value);
 
+            bool PutIfAbsent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options);
+
             void Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value);
 
+            void Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options);
+
+            bool TryPut(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value);
+
+            bool TryPut(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, WriteOptions^ options);
+
+            void Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, DateTimeOffset expiresAt);
+
+            void Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, DateTimeOffset expiresAt,
+                WriteOptions^ options);
+
+            void Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, TimeSpan timeToLive);
+
+            void Put(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, TimeSpan timeToLive,
+                WriteOptions^ options);
+
             NativeBytes^ Get(Kind^ kind, ReadOnlySpan<Byte> key);
 
+            NativeBytes^ Get(Kind^ kind, ReadOnlySpan<Byte> key, Snapshot^ snapshot);
+
+            NativeBytes^ Get(Kind^ kind, ReadOnlySpan<Byte> key, ReadOptions^ options);
+
+            // Returns up to length bytes of the value starting at offset (empty if offset is at or past
+            // its end), or null if the key doesn't exist. Only as much as the value holds is allocated.
+            NativeBytes^ Get(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, int length);
+
+            NativeBytes^ Get(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, int length, ReadOptions^ options);
+
+            ValueReadStream^ OpenValueReadStream(Kind^ kind, ReadOnlySpan<Byte> key);
+
+            ValueReadStream^ OpenValueReadStream(Kind^ kind, ReadOnlySpan<Byte> key, ReadOptions^ options);
+
+            ValueWriteStream^ OpenValueWriteStream(Kind^ kind, ReadOnlySpan<Byte> key);
+
+            ValueWriteStream^ OpenValueWriteStream(Kind^ kind, ReadOnlySpan<Byte> key, Int64 expectedSize);
+
+            bool Contains(Kind^ kind, ReadOnlySpan<Byte> key);
+
+            bool TryGetValueSize(Kind^ kind, ReadOnlySpan<Byte> key, [Out] Int64% valueSize);
+
+            IReadOnlyList<NativeBytes^>^ MultiGet(Kind^ kind, IReadOnlyList<array<Byte>^>^ keys);
+
+            IReadOnlyList<NativeBytes^>^ MultiGet(Kind^ kind, IReadOnlyList<array<Byte>^>^ keys, Snapshot^ snapshot);
+
+            // snapshot may be null
+            IReadOnlyList<NativeBytes^>^ MultiGet(Kind^ kind, IReadOnlyList<array<Byte>^>^ keys, Snapshot^ snapshot,
+                ReadOptions^ options);
+
             NativeBytes^ SingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key);
 
+            NativeBytes^ SingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options);
+
             NativeBytes^ RemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key);
 
+            NativeBytes^ RemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options);
+
             void SingleRemove(Kind^ kind, ReadOnlySpan<Byte> key);
 
+            void SingleRemove(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options);
+
             void Remove(Kind^ kind, ReadOnlySpan<Byte> key);
 
+            void Remove(Kind^ kind, ReadOnlySpan<Byte> key, WriteOptions^ options);
+
             NativeBytes^ FindMinKey(Kind^ kind);
 
+            NativeBytes^ FindMinKey(Kind^ kind, ReadOptions^ options);
+
             NativeBytes^ FindMaxKey(Kind^ kind);
 
+            NativeBytes^ FindMaxKey(Kind^ kind, ReadOptions^ options);
+
+            // The ranges of RemoveRange(), PurgeRange() and ApproximateSize() are [beginKeyInclusive, endKeyExclusive).
+            // An empty beginKeyInclusive is the smallest key, so the range starts at the first key of the Kind.
+            // An empty endKeyExclusive would make the range empty and throws an ArgumentException, the ...From()
+            // variants cover a range that extends to the end of the Kind.
+
+            void RemoveRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive);
+
+            void RemoveRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                WriteOptions^ options);
+
+            // Removes beginKeyInclusive and all keys after it
+            void RemoveRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive);
+
+            void RemoveRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, WriteOptions^ options);
+
+            void PurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive);
+
+            void PurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                bool compactBoundaries);
+
+            void PurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                bool compactBoundaries, WriteOptions^ options);
+
+            // Purges beginKeyInclusive and all keys after it
+            void PurgeRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive);
+
+            void PurgeRangeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, bool compactBoundaries,
+                WriteOptions^ options);
+
+            UInt64 ApproximateSize(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive);
+
+            void ApproximateSize(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                [Out] UInt64% onDiskBytes, [Out] UInt64% memtableBytes);
+
+            // Size of beginKeyInclusive and all keys after it
+            UInt64 ApproximateSizeFrom(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive);
+
+            UInt64 EstimateNumKeys(Kind^ kind);
+
+            BlobStats GetBlobStats(Kind^ kind);
+
+            MemoryUsage GetMemoryUsage();
+
+            // Timings and counts of the open, see KeyValueStoreOptions::RecoveryThreads and LazyKindOpening
+            RecoveryReport GetRecoveryReport();
+
             bool TryUpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, Span<Byte> dest, [Out] int% bytesWritten);
 
+            bool TryUpdateIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value, Span<Byte> dest, [Out] int% bytesWritten,
+                WriteOptions^ options);
+
             bool TryGet(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, [Out] int% bytesWritten);
 
+            bool TryGet(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, Span<Byte> dest, [Out] int% bytesWritten);
+
+            bool TryGet(Kind^ kind, ReadOnlySpan<Byte> key, Int64 offset, Span<Byte> dest, [Out] int% bytesWritten,
+                ReadOptions^ options);
+
             bool TrySingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, [Out] int% bytesWritten);
 
+            bool TrySingleRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, [Out] int% bytesWritten,
+                WriteOptions^ options);
+
             bool TryRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, [Out] int% bytesWritten);
 
+            bool TryRemoveIfPresent(Kind^ kind, ReadOnlySpan<Byte> key, Span<Byte> dest, [Out] int% bytesWritten,
+                WriteOptions^ options);
+
             bool TryFindMinKey(Kind^ kind, Span<Byte> dest, [Out] int% bytesWritten);
 
             bool TryFindMaxKey(Kind^ kind, Span<Byte> dest, [Out] int% bytesWritten);
 
 
+        internal:
+            // returns -1 if the key doesn't exist
+            int ReadRange(Kind^ kind, ReadOnlySpan<Byte> key, Snapshot^ snapshot, ReadOptions^ options, Int64 offset,
+                Span<Byte> dest, Int64% valueSize);
+
 #pragma warning(pop)
+
+            Kind^ WrapKind(const ::Kind* nativePtr);
+
+            // for handles whose native calls run a (possibly sampled) operation of the store
+            void RecordPerfSampleIfEnabled(String^ operation) {
+                if (_perfSampling) RecordPerfSample(operation);
+            }
+
+            // Snapshots, SstWriters, CompactionJobs and ChangeFeeds refer to the native store, the
+            // ones that are still alive when the store is closed get disposed before it
+            void AddDependent(IDisposable^ dependent) {
+                _dependents->TryAdd(dependent, true);
+            }
+
+            void RemoveDependent(IDisposable^ dependent) {
+                bool ignored;
+                _dependents->TryRemove(dependent, ignored);
+            }
+
+            void ReleaseSnapshot(const ::Snapshot* snapshot) {
+                if (_nativePtr) {
+                    _nativePtr->releaseSnapshot(snapshot);
+                }
+            }
+
         private:
             KVStore* _nativePtr;
+            bool _perfSampling;
+
+            KeyValueStore(String^ path, const ::KVStoreOptions& nativeOptions) {
+                Open(path, nativeOptions);
+            }
+
+            static initonly Diagnostics::ActivitySource^ PerfActivitySource = gcnew Diagnostics::ActivitySource(ActivitySourceName);
+
+            static initonly ReadOptions^ DefaultReadOptions = gcnew ReadOptions();
+            static initonly WriteOptions^ DefaultWriteOptions = gcnew WriteOptions();
+
+            void Open(String^ path, const ::KVStoreOptions& nativeOptions) {
+                _dependents = gcnew ConcurrentDictionary<IDisposable^, bool>();
+                std::string dbPath { marshal::marshal_as<std::string>(path) };
+                try {
+                    _nativePtr = new KVStore(dbPath, nativeOptions);
+                    _perfSampling = nativeOptions.perfSampleInterval > 0;
+                }
+                catch (RocksDbException^) {
+                    _nativePtr = nullptr;
+                    throw;
+                }
+                catch (...) {
+                    _nativePtr = nullptr;
+                    throw gcnew Exception("An unknown error occurred during KeyValueStore initialization.");
+                }
+            }
+
+            void RecordPerfSample(String^ operation);
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+            void DoRemoveRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                bool unboundedEnd, WriteOptions^ options);
+
+            void DoPurgeRange(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                bool unboundedEnd, bool compactBoundaries, WriteOptions^ options);
+
+            void DoApproximateSize(Kind^ kind, ReadOnlySpan<Byte> beginKeyInclusive, ReadOnlySpan<Byte> endKeyExclusive,
+                bool unboundedEnd, UInt64% onDiskBytes, UInt64% memtableBytes);
+
+
+            static void ThrowIfEmptyEnd(ReadOnlySpan<Byte> endKeyExclusive) {
+                if (endKeyExclusive.IsEmpty) {
+                    throw gcnew ArgumentException("An empty endKeyExclusive makes the range empty, "
+                        "use the ...From() variant for a range up to the end of the Kind", "endKeyExclusive");
+                }
+            }
+
+#pragma warning(pop)
 
             void ThrowIfDisposed() {
                 if (_nativePtr == nullptr) {
@@ -135,8 +481,23 @@ namespace librocks::Net {
                 }
             }
 
-            Kind^ WrapKind(const ::Kind* nativePtr);
+            // a released or foreign Snapshot must never reach the native read
+            void ThrowIfForeign(Snapshot^ snapshot) {
+                if (snapshot->IsReleased) throw gcnew ObjectDisposedException("Snapshot");
+                if (!ReferenceEquals(snapshot->_owner, this)) {
+                    throw gcnew ArgumentException("The Snapshot belongs to another KeyValueStore", "snapshot");
+                }
+            }
+
+            void DisposeDependents() {
+                // Keys is a copy, the dependents remove themselves while being disposed
+                for each (IDisposable^ dependent in _dependents->Keys) {
+                    delete dependent;
+                }
+            }
+
             Kind^ CreateKindWrapper(IntPtr key);
             ConcurrentDictionary<IntPtr, Kind^>^ _kindCache;
+            ConcurrentDictionary<IDisposable^, bool>^ _dependents;
     };
 }
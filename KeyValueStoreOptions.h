@@ -0,0 +1,174 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/KVStoreOptions.h"
+
+#include <msclr/marshal_cppstd.h>
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public enum class OpenMode {
+        ReadWrite = static_cast<int>(::OpenMode::ReadWrite),
+        // No write path and no lock on the store, so that other processes can read it while the
+        // primary keeps writing. Sees the data as of the time the store was opened.
+        ReadOnly = static_cast<int>(::OpenMode::ReadOnly),
+        // Like ReadOnly, but KeyValueStore::TryCatchUpWithPrimary() picks up newer writes (requires SecondaryPath)
+        Secondary = static_cast<int>(::OpenMode::Secondary)
+    };
+
+    public ref class KeyValueStoreOptions sealed
+    {
+        public:
+            KeyValueStoreOptions() {
+                ::KVStoreOptions defaults;
+                ReadCacheCapacity = static_cast<Int64>(defaults.readCacheCapacity);
+                ReadCacheShardBits = static_cast<int>(defaults.readCacheShardBits);
+                CoalesceReads = defaults.coalesceReads;
+                PerfSampleInterval = static_cast<int>(defaults.perfSampleInterval);
+                Mode = static_cast<OpenMode>(defaults.openMode);
+                HotKeySampleInterval = static_cast<int>(defaults.hotKeySampleInterval);
+                HotKeyTopK = static_cast<int>(defaults.hotKeyTopK);
+                HotKeyPrefixLength = static_cast<int>(defaults.hotKeyPrefixLength);
+                UseDirectReads = defaults.storeOptions.useDirectReads;
+                UseDirectIoForFlushAndCompaction = defaults.storeOptions.useDirectIoForFlushAndCompaction;
+                AllowMmapReads = defaults.storeOptions.allowMmapReads;
+                CompactionReadaheadSize = static_cast<Int64>(defaults.storeOptions.compactionReadaheadSize);
+                BlockCacheCapacity = static_cast<Int64>(defaults.storeOptions.blockCacheCapacity);
+                WriteBufferLimit = static_cast<Int64>(defaults.storeOptions.writeBufferLimit);
+                WalRetention = TimeSpan::FromSeconds(static_cast<double>(defaults.storeOptions.walRetentionSeconds));
+                RecoveryThreads = static_cast<int>(defaults.storeOptions.recoveryThreads);
+                LazyKindOpening = defaults.storeOptions.lazyKindOpening;
+                AvoidFlushDuringRecovery = defaults.storeOptions.avoidFlushDuringRecovery;
+                SkipStatsUpdateOnOpen = defaults.storeOptions.skipStatsUpdateOnOpen;
+            }
+
+            // Byte budget of the in-process read cache for hot keys, 0 disables the cache.
+            property Int64 ReadCacheCapacity;
+
+            property int ReadCacheShardBits;
+
+            // Concurrent Get() calls for the same key share a single lookup and result buffer.
+            property bool CoalesceReads;
+
+            // Capture the RocksDB perf context of every n-th operation per thread and report it as an
+            // Activity of the KeyValueStore::ActivitySourceName source, 0 disables sampling.
+            property int PerfSampleInterval;
+
+            // Record a binary trace of all point operations to this file (see KeyValueStore::ReplayTrace),
+            // null disables tracing. The trace is complete once the KeyValueStore has been closed.
+            property String^ TraceFile;
+
+            // Count every n-th read and write per thread for hot key detection (see KeyValueStore::GetHotKeys),
+            // 0 disables it. Uses a fixed amount of memory per Kind.
+            property int HotKeySampleInterval;
+
+            // Length of the hot key lists per Kind, at most 64
+            property int HotKeyTopK;
+
+            // Also detect hot key prefixes of this length, 0 disables prefix tracking
+            property int HotKeyPrefixLength;
+
+            property OpenMode Mode;
+
+            // Private directory for the logs of a Secondary instance
+            property String^ SecondaryPath;
+
+            // The I/O modes are validated when the store is opened, a filesystem that doesn't
+            // support them makes the constructor throw a RocksDbException (NotSupported).
+
+            // Bypass the OS page cache for reads so that data isn't cached twice.
+            property bool UseDirectReads;
+
+            property bool UseDirectIoForFlushAndCompaction;
+
+            // For read-mostly stores, can't be combined with UseDirectReads.
+            property bool AllowMmapReads;
+
+            // 0 uses the RocksDB default
+            property Int64 CompactionReadaheadSize;
+
+            // 0 uses the RocksDB default
+            property Int64 BlockCacheCapacity;
+
+            // Single cap on the memtable memory of all Kinds, charged against the block cache
+            // so that BlockCacheCapacity bounds both. 0 means no shared limit.
+            property Int64 WriteBufferLimit;
+
+            // Keeps flushed WAL files around so that a ChangeFeed can resume from older positions
+            property TimeSpan WalRetention;
+
+            // Threads that replay the WAL and open the table files in parallel during open,
+            // 0 uses one per hardware thread and 1 opens sequentially
+            property int RecoveryThreads;
+
+            // Load the table files of a Kind on its first GetOrCreateKind() instead of during open
+            property bool LazyKindOpening;
+
+            // Don't flush the replayed WAL at the end of the recovery, the next regular flush does it
+            property bool AvoidFlushDuringRecovery;
+
+            // Don't read the properties of every table file for the size and key count statistics
+            property bool SkipStatsUpdateOnOpen;
+
+        internal:
+            ::KVStoreOptions ToNative() {
+                if (ReadCacheCapacity < 0) throw gcnew ArgumentOutOfRangeException("ReadCacheCapacity");
+                if (ReadCacheShardBits < 0 || ReadCacheShardBits > 16) throw gcnew ArgumentOutOfRangeException("ReadCacheShardBits");
+                if (PerfSampleInterval < 0) throw gcnew ArgumentOutOfRangeException("PerfSampleInterval");
+                if (Mode == OpenMode::Secondary && String::IsNullOrEmpty(SecondaryPath)) {
+                    throw gcnew ArgumentException("A Secondary store requires a SecondaryPath");
+                }
+                if (HotKeySampleInterval < 0) throw gcnew ArgumentOutOfRangeException("HotKeySampleInterval");
+                if (HotKeyTopK < 1 || HotKeyTopK > 64) throw gcnew ArgumentOutOfRangeException("HotKeyTopK");
+                if (HotKeyPrefixLength < 0) throw gcnew ArgumentOutOfRangeException("HotKeyPrefixLength");
+                if (CompactionReadaheadSize < 0) throw gcnew ArgumentOutOfRangeException("CompactionReadaheadSize");
+                if (BlockCacheCapacity < 0) throw gcnew ArgumentOutOfRangeException("BlockCacheCapacity");
+                if (WriteBufferLimit < 0) throw gcnew ArgumentOutOfRangeException("WriteBufferLimit");
+                if (WalRetention < TimeSpan::Zero) throw gcnew ArgumentOutOfRangeException("WalRetention");
+                if (RecoveryThreads < 0) throw gcnew ArgumentOutOfRangeException("RecoveryThreads");
+                ::KVStoreOptions options;
+                options.readCacheCapacity = static_cast<size_t>(ReadCacheCapacity);
+                options.readCacheShardBits = static_cast<unsigned int>(ReadCacheShardBits);
+                options.coalesceReads = CoalesceReads;
+                options.perfSampleInterval = static_cast<unsigned int>(PerfSampleInterval);
+                options.hotKeySampleInterval = static_cast<unsigned int>(HotKeySampleInterval);
+                options.hotKeyTopK = static_cast<unsigned int>(HotKeyTopK);
+                options.hotKeyPrefixLength = static_cast<unsigned int>(HotKeyPrefixLength);
+                options.openMode = static_cast<::OpenMode>(Mode);
+                if (!String::IsNullOrEmpty(SecondaryPath)) {
+                    options.secondaryPath = msclr::interop::marshal_as<std::string>(SecondaryPath);
+                }
+                if (!String::IsNullOrEmpty(TraceFile)) {
+                    options.traceFile = msclr::interop::marshal_as<std::string>(TraceFile);
+                }
+                options.storeOptions.useDirectReads = UseDirectReads;
+                options.storeOptions.useDirectIoForFlushAndCompaction = UseDirectIoForFlushAndCompaction;
+                options.storeOptions.allowMmapReads = AllowMmapReads;
+                options.storeOptions.compactionReadaheadSize = static_cast<size_t>(CompactionReadaheadSize);
+                options.storeOptions.blockCacheCapacity = static_cast<size_t>(BlockCacheCapacity);
+                options.storeOptions.writeBufferLimit = static_cast<size_t>(WriteBufferLimit);
+                options.storeOptions.walRetentionSeconds = static_cast<unsigned long long>(WalRetention.TotalSeconds);
+                options.storeOptions.recoveryThreads = static_cast<unsigned int>(RecoveryThreads);
+                options.storeOptions.lazyKindOpening = LazyKindOpening;
+                options.storeOptions.avoidFlushDuringRecovery = AvoidFlushDuringRecovery;
+                options.storeOptions.skipStatsUpdateOnOpen = SkipStatsUpdateOnOpen;
+                return options;
+            }
+    };
+}
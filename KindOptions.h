@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/KindOptions.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public enum class Compression {
+        None = ::Compression::None,
+        Snappy = ::Compression::Snappy,
+        Zlib = ::Compression::Zlib,
+        BZip2 = ::Compression::BZip2,
+        LZ4 = ::Compression::LZ4,
+        LZ4HC = ::Compression::LZ4HC,
+        Xpress = ::Compression::Xpress,
+        ZSTD = ::Compression::ZSTD
+    };
+
+    // Per-Kind options for KeyValueStore::GetOrCreateKind(). Values of at least
+    // MinBlobSize bytes are kept in blob files so that compaction only has to
+    // rewrite the keys. Expired entries (TimeToLive or per-entry expiry) are
+    // hidden from reads and dropped by compaction. All options except for
+    // PerEntryExpiry can be changed for an existing Kind.
+    public ref class KindOptions sealed
+    {
+        public:
+            KindOptions() {
+                ::KindOptions defaults;
+                EnableBlobFiles = defaults.enableBlobFiles;
+                MinBlobSize = defaults.minBlobSize;
+                BlobCompression = static_cast<Compression>(defaults.blobCompression);
+                EnableBlobGarbageCollection = defaults.enableBlobGarbageCollection;
+                BlobGarbageCollectionAgeCutoff = defaults.blobGarbageCollectionAgeCutoff;
+                TimeToLive = TimeSpan::FromSeconds(static_cast<double>(defaults.ttlSeconds));
+                PerEntryExpiry = defaults.perEntryExpiry;
+            }
+
+        internal:
+            KindOptions(const ::KindOptions& options) {
+                EnableBlobFiles = options.enableBlobFiles;
+                MinBlobSize = options.minBlobSize;
+                BlobCompression = static_cast<Compression>(options.blobCompression);
+                EnableBlobGarbageCollection = options.enableBlobGarbageCollection;
+                BlobGarbageCollectionAgeCutoff = options.blobGarbageCollectionAgeCutoff;
+                TimeToLive = TimeSpan::FromSeconds(static_cast<double>(options.ttlSeconds));
+                PerEntryExpiry = options.perEntryExpiry;
+            }
+
+        public:
+
+            property bool EnableBlobFiles;
+
+            property UInt64 MinBlobSize;
+
+            property Compression BlobCompression;
+
+            property bool EnableBlobGarbageCollection;
+
+            property double BlobGarbageCollectionAgeCutoff;
+
+            // TimeSpan::Zero disables the TTL, the resolution is one second
+            property TimeSpan TimeToLive;
+
+            property bool PerEntryExpiry;
+
+        internal:
+            ::KindOptions ToNative() {
+                if (BlobGarbageCollectionAgeCutoff < 0.0 || BlobGarbageCollectionAgeCutoff > 1.0) {
+                    throw gcnew ArgumentOutOfRangeException("BlobGarbageCollectionAgeCutoff");
+                }
+                if (TimeToLive < TimeSpan::Zero) throw gcnew ArgumentOutOfRangeException("TimeToLive");
+                ::KindOptions options;
+                options.enableBlobFiles = EnableBlobFiles;
+                options.minBlobSize = MinBlobSize;
+                options.blobCompression = static_cast<int>(BlobCompression);
+                options.enableBlobGarbageCollection = EnableBlobGarbageCollection;
+                options.blobGarbageCollectionAgeCutoff = BlobGarbageCollectionAgeCutoff;
+                options.ttlSeconds = static_cast<unsigned long long>(Math::Ceiling(TimeToLive.TotalSeconds));
+                options.perEntryExpiry = PerEntryExpiry;
+                return options;
+            }
+    };
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/MemoryUsage.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public value struct MemoryUsage
+    {
+        internal:
+            MemoryUsage(const ::MemoryUsage& usage)
+                : Memtables(usage.memtables), BlockCache(usage.blockCache),
+                  BlockCachePinned(usage.blockCachePinned), IndexAndFilterBlocks(usage.indexAndFilterBlocks),
+                  ReadCache(usage.readCache), LiveResultBuffers(usage.liveResultBuffers) {}
+
+        public:
+            initonly UInt64 Memtables;
+            initonly UInt64 BlockCache;
+            initonly UInt64 BlockCachePinned;
+            initonly UInt64 IndexAndFilterBlocks;
+            initonly UInt64 ReadCache;
+            // Process-wide: native result buffers still held by undisposed NativeBytes or a read cache
+            initonly UInt64 LiveResultBuffers;
+    };
+}
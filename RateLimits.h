@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/RateLimits.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    // Background I/O budgets in bytes per second, 0 means unlimited. With
+    // AutoTune the limiter adapts the budgets within those bounds to the demand.
+    public ref class RateLimits sealed
+    {
+        public:
+            RateLimits() {
+                ::RateLimits defaults;
+                FlushBytesPerSecond = defaults.flushBytesPerSec;
+                CompactionBytesPerSecond = defaults.compactionBytesPerSec;
+                AutoTune = defaults.autoTune;
+            }
+
+        internal:
+            RateLimits(const ::RateLimits& limits) {
+                FlushBytesPerSecond = limits.flushBytesPerSec;
+                CompactionBytesPerSecond = limits.compactionBytesPerSec;
+                AutoTune = limits.autoTune;
+            }
+
+        public:
+            property UInt64 FlushBytesPerSecond;
+
+            property UInt64 CompactionBytesPerSecond;
+
+            property bool AutoTune;
+
+        internal:
+            ::RateLimits ToNative() {
+                ::RateLimits limits;
+                limits.flushBytesPerSec = FlushBytesPerSecond;
+                limits.compactionBytesPerSec = CompactionBytesPerSecond;
+                limits.autoTune = AutoTune;
+                return limits;
+            }
+    };
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/ReadCache.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public value struct ReadCacheStats
+    {
+        internal:
+            ReadCacheStats(const ::ReadCacheStats& stats)
+                : Hits(stats.hits), Misses(stats.misses), Entries(stats.entries),
+                  Usage(stats.usage), Capacity(stats.capacity) {}
+
+        public:
+            initonly UInt64 Hits;
+            initonly UInt64 Misses;
+            initonly UInt64 Entries;
+            initonly UInt64 Usage;
+            initonly UInt64 Capacity;
+    };
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/ReadOptions.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    // Per-read settings. Bulk readers (scans, exports) should turn off
+    // FillCache so that they don't evict the interactive working set.
+    public ref class ReadOptions sealed
+    {
+        public:
+            ReadOptions() {
+                ::ReadOptions defaults;
+                FillCache = defaults.fillCache;
+                ReadaheadSize = static_cast<Int64>(defaults.readaheadSize);
+                AsyncIo = defaults.asyncIo;
+                VerifyChecksums = defaults.verifyChecksums;
+                Timeout = TimeSpan::Zero;
+            }
+
+            property bool FillCache;
+
+            // 0 lets RocksDB pick an adaptive readahead size
+            property Int64 ReadaheadSize {
+                Int64 get() { return _readaheadSize; }
+                void set(Int64 value) {
+                    if (value < 0) throw gcnew ArgumentOutOfRangeException("value");
+                    _readaheadSize = value;
+                }
+            }
+
+            property bool AsyncIo;
+
+            property bool VerifyChecksums;
+
+            // A read that takes longer fails with a RocksDbException (TimedOut), TimeSpan.Zero means no limit
+            property TimeSpan Timeout {
+                TimeSpan get() { return _timeout; }
+                void set(TimeSpan value) {
+                    if (value < TimeSpan::Zero) throw gcnew ArgumentOutOfRangeException("value");
+                    _timeout = value;
+                }
+            }
+
+        internal:
+            ::ReadOptions ToNative() {
+                ::ReadOptions options;
+                options.fillCache = FillCache;
+                options.readaheadSize = static_cast<size_t>(ReadaheadSize);
+                options.asyncIo = AsyncIo;
+                options.verifyChecksums = VerifyChecksums;
+                // TimeSpan ticks are 100 ns
+                Int64 micros = _timeout.Ticks / 10;
+                options.timeoutMicros = (micros == 0 && _timeout.Ticks > 0) ? 1 : static_cast<unsigned long long>(micros);
+                return options;
+            }
+
+        private:
+            Int64 _readaheadSize;
+            TimeSpan _timeout;
+    };
+}
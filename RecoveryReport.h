@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/RecoveryReport.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    // What opening the KeyValueStore took. The phases of a parallel open overlap,
+    // so the phase durations don't add up to Total.
+    public value struct RecoveryReport
+    {
+        internal:
+            RecoveryReport(const ::RecoveryReport& report)
+                : Total(FromMicros(report.totalMicros)), Manifest(FromMicros(report.manifestMicros)),
+                  WalReplay(FromMicros(report.walReplayMicros)), TableLoad(FromMicros(report.tableLoadMicros)),
+                  WalFilesReplayed(report.walFilesReplayed), WalBytesReplayed(report.walBytesReplayed),
+                  WalRecordsReplayed(report.walRecordsReplayed), TableFilesLoaded(report.tableFilesLoaded),
+                  TableFiles(report.tableFiles), KindsOpened(report.kindsOpened), KindsDeferred(report.kindsDeferred) {}
+
+        public:
+            initonly TimeSpan Total;
+            initonly TimeSpan Manifest;
+            initonly TimeSpan WalReplay;
+            initonly TimeSpan TableLoad;
+            initonly UInt32 WalFilesReplayed;
+            initonly UInt64 WalBytesReplayed;
+            initonly UInt64 WalRecordsReplayed;
+            initonly UInt32 TableFilesLoaded;
+            // The table files that aren't loaded yet belong to Kinds deferred by LazyKindOpening
+            initonly UInt32 TableFiles;
+            initonly UInt32 KindsOpened;
+            initonly UInt32 KindsDeferred;
+
+        private:
+            static TimeSpan FromMicros(unsigned long long micros) {
+                return TimeSpan::FromTicks(static_cast<Int64>(micros * 10));
+            }
+    };
+}
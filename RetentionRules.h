@@ -0,0 +1,79 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/RetentionRules.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace librocks::Net {
+
+    // Rules of a Kind's native compaction filter, see KeyValueStore::SetCompactionFilter().
+    // An entry is dropped when compaction encounters it and any of the rules matches.
+    public ref class RetentionRules sealed
+    {
+        public:
+            RetentionRules() {
+                ::RetentionRules defaults;
+                DropKeyPrefixes = gcnew List<array<Byte>^>();
+                DropValuePrefixes = gcnew List<array<Byte>^>();
+                TimestampInValue = defaults.timestampInValue;
+                TimestampOffset = static_cast<int>(defaults.timestampOffset);
+                TimestampWidth = static_cast<int>(defaults.timestampWidth);
+                TimestampCutoff = defaults.timestampCutoff;
+            }
+
+            property List<array<Byte>^>^ DropKeyPrefixes;
+
+            property List<array<Byte>^>^ DropValuePrefixes;
+
+            // Location of a big-endian timestamp of TimestampWidth (4 or 8) bytes in the
+            // key (or the value). Entries whose timestamp is < TimestampCutoff are dropped,
+            // a TimestampCutoff of 0 disables this rule.
+            property bool TimestampInValue;
+
+            property int TimestampOffset;
+
+            property int TimestampWidth;
+
+            property UInt64 TimestampCutoff;
+
+        internal:
+            ::RetentionRules ToNative() {
+                if (TimestampOffset < 0) throw gcnew ArgumentOutOfRangeException("TimestampOffset");
+                if (!(TimestampWidth == 4 || TimestampWidth == 8)) throw gcnew ArgumentOutOfRangeException("TimestampWidth");
+                ::RetentionRules rules;
+                CopyPrefixes(DropKeyPrefixes, rules.dropKeyPrefixes);
+                CopyPrefixes(DropValuePrefixes, rules.dropValuePrefixes);
+                rules.timestampInValue = TimestampInValue;
+                rules.timestampOffset = static_cast<size_t>(TimestampOffset);
+                rules.timestampWidth = static_cast<unsigned int>(TimestampWidth);
+                rules.timestampCutoff = TimestampCutoff;
+                return rules;
+            }
+
+        private:
+            static void CopyPrefixes(List<array<Byte>^>^ prefixes, std::vector<std::string>& nativePrefixes) {
+                if (prefixes == nullptr) return;
+                for each (array<Byte>^ prefix in prefixes) {
+                    if (prefix == nullptr || prefix->Length == 0) continue;
+                    pin_ptr<const Byte> pPrefix = &prefix[0];
+                    nativePrefixes.emplace_back(reinterpret_cast<const char*>(pPrefix), prefix->Length);
+                }
+            }
+    };
+}
@@ -0,0 +1,23 @@
+#include "pch.h"
+#include "Snapshot.h"
+#include "KeyValueStore.h"
+
+namespace librocks::Net {
+
+    Snapshot::!Snapshot()
+    {
+        if (_nativePtr) {
+            // the store disposes its snapshots before it closes, so it's still open here
+            _owner->ReleaseSnapshot(_nativePtr);
+            _nativePtr = nullptr;
+            _owner->RemoveDependent(this);
+        }
+    }
+
+    UInt64 Snapshot::SequenceNumber::get()
+    {
+        if (_nativePtr == nullptr) throw gcnew ObjectDisposedException("Snapshot");
+        if (!_owner->IsOpen) throw gcnew ObjectDisposedException("KeyValueStore");
+        return _nativePtr->sequenceNumber();
+    }
+}
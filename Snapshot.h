@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/Snapshot.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    ref class KeyValueStore;
+
+    public ref class Snapshot sealed : public IDisposable
+    {
+        internal:
+            Snapshot(KeyValueStore^ owner, const ::Snapshot* nativeSnapshot)
+                : _nativePtr(nativeSnapshot), _owner(owner) {}
+
+        public:
+            // Inherited via IDisposable
+            ~Snapshot() { this->!Snapshot(); } // Dispose()
+
+        protected:
+            // Finalizer
+            !Snapshot();
+
+        public:
+            // Throws ObjectDisposedException once the snapshot is released (closing the store releases it)
+            property UInt64 SequenceNumber {
+                UInt64 get();
+            }
+
+            property bool IsReleased {
+                bool get() {
+                    return _nativePtr == nullptr;
+                }
+            }
+
+        internal:
+            const ::Snapshot* _nativePtr;
+            KeyValueStore^ _owner;
+    };
+}
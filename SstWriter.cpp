@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pch.h"
+#include "SstWriter.h"
+#include "KeyValueStore.h"
+
+namespace marshal = msclr::interop;
+
+namespace librocks::Net {
+
+    SstWriter::!SstWriter()
+    {
+        if (_nativePtr) {
+            delete _nativePtr;
+            _nativePtr = nullptr;
+            _owner->RemoveDependent(this);
+        }
+    }
+
+    void SstWriter::ThrowIfDisposed()
+    {
+        if (_nativePtr == nullptr) throw gcnew ObjectDisposedException("SstWriter");
+        // the native writer refers to the store, so it must still be open
+        if (!_owner->IsOpen) throw gcnew ObjectDisposedException("KeyValueStore");
+    }
+
+    void SstWriter::Open(String^ filePath)
+    {
+        ThrowIfDisposed();
+        if (filePath == nullptr) throw gcnew ArgumentNullException("filePath");
+        try {
+            std::string path{ marshal::marshal_as<std::string>(filePath) };
+            _nativePtr->open(path);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred while opening the SST file: " + filePath);
+        }
+    }
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+    void SstWriter::Put(ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value)
+    {
+        ThrowIfDisposed();
+
+        std::string_view nativeKeyView;
+        std::string_view nativeValueView;
+
+        pin_ptr<const Byte> pKey;
+        pin_ptr<const Byte> pValue;
+
+        if (key.Length > 0) {
+            pKey = &MemoryMarshal::GetReference(key);
+            nativeKeyView = std::string_view(reinterpret_cast<const char*>(pKey), key.Length);
+        }
+
+        if (value.Length > 0) {
+            pValue = &MemoryMarshal::GetReference(value);
+            nativeValueView = std::string_view(reinterpret_cast<const char*>(pValue), value.Length);
+        }
+
+        try {
+            _nativePtr->put(nativeKeyView, nativeValueView);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during SstWriter Put() operation.");
+        }
+    }
+
+#pragma warning(pop)
+
+    void SstWriter::Finish()
+    {
+        ThrowIfDisposed();
+        try {
+            _nativePtr->finish();
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred while finishing the SST file.");
+        }
+    }
+}
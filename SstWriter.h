@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/SstFileWriter.h"
+
+#include <msclr/marshal_cppstd.h>
+#include "RocksDbException.h"
+
+using namespace System;
+using namespace System::Runtime::InteropServices;
+
+namespace librocks::Net {
+
+    ref class KeyValueStore;
+
+    // Streams key/value pairs in strictly ascending key order into an
+    // external SST file that can then be ingested with KeyValueStore::Ingest().
+    public ref class SstWriter sealed : public IDisposable
+    {
+        internal:
+            SstWriter(KeyValueStore^ owner, SstFileWriter* nativeWriter) : _owner(owner), _nativePtr(nativeWriter) {}
+
+        public:
+            // Inherited via IDisposable
+            ~SstWriter() { this->!SstWriter(); } // Dispose()
+
+        protected:
+            // Finalizer
+            !SstWriter();
+
+        public:
+            void Open(String^ filePath);
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+            void Put(ReadOnlySpan<Byte> key, ReadOnlySpan<Byte> value);
+
+#pragma warning(pop)
+
+            void Finish();
+
+            property UInt64 FileSize {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->fileSize();
+                }
+            }
+
+            property UInt64 NumEntries {
+                UInt64 get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->numEntries();
+                }
+            }
+
+        private:
+            KeyValueStore^ _owner;
+            SstFileWriter* _nativePtr;
+
+            void ThrowIfDisposed();
+    };
+}
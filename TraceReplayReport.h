@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/TraceReplayer.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    public value struct TraceReplayReport
+    {
+        internal:
+            TraceReplayReport(const ::TraceReplayReport& report)
+                : Operations(report.operations), FailedOperations(report.failedOperations),
+                  Elapsed(TimeSpan::FromTicks(static_cast<Int64>(report.elapsedNanos / 100))),
+                  OperationsPerSecond(report.operationsPerSecond), MeanLatencyNanos(report.meanLatencyNanos),
+                  P50LatencyNanos(report.p50LatencyNanos), P99LatencyNanos(report.p99LatencyNanos),
+                  P999LatencyNanos(report.p999LatencyNanos), MaxLatencyNanos(report.maxLatencyNanos) {}
+
+        public:
+            initonly UInt64 Operations;
+            // Operations that failed with a status other than NotFound or AlreadyExists
+            initonly UInt64 FailedOperations;
+            initonly TimeSpan Elapsed;
+            initonly double OperationsPerSecond;
+            initonly UInt64 MeanLatencyNanos;
+            initonly UInt64 P50LatencyNanos;
+            initonly UInt64 P99LatencyNanos;
+            initonly UInt64 P999LatencyNanos;
+            initonly UInt64 MaxLatencyNanos;
+    };
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pch.h"
+#include "ValueReadStream.h"
+#include "KeyValueStore.h"
+
+namespace librocks::Net {
+
+    int ValueReadStream::Read(array<Byte>^ buffer, int offset, int count)
+    {
+        if (buffer == nullptr) throw gcnew ArgumentNullException("buffer");
+        return Read(Span<Byte>(buffer, offset, count));
+    }
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+    int ValueReadStream::Read(Span<Byte> buffer)
+    {
+        ThrowIfDisposed();
+        if (buffer.Length == 0 || _position >= _length) return 0;
+        Int64 valueSize = 0;
+        int bytesRead = _owner->ReadRange(_kind, ReadOnlySpan<Byte>(_key), _snapshot, _options, _position, buffer,
+            valueSize);
+        if (bytesRead < 0) {
+            // can't happen while we hold the snapshot
+            throw gcnew InvalidOperationException("The value has vanished from the Snapshot.");
+        }
+        _position += bytesRead;
+        return bytesRead;
+    }
+
+#pragma warning(pop)
+
+    Int64 ValueReadStream::Seek(Int64 offset, SeekOrigin origin)
+    {
+        ThrowIfDisposed();
+        Int64 newPosition;
+        switch (origin) {
+        case SeekOrigin::Begin:
+            newPosition = offset;
+            break;
+        case SeekOrigin::Current:
+            newPosition = _position + offset;
+            break;
+        case SeekOrigin::End:
+            newPosition = _length + offset;
+            break;
+        default:
+            throw gcnew ArgumentException("Invalid SeekOrigin", "origin");
+        }
+        if (newPosition < 0) throw gcnew IOException("An attempt was made to move the position before the beginning.");
+        _position = newPosition;
+        return _position;
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "Kind.h"
+#include "Snapshot.h"
+#include "ReadOptions.h"
+
+using namespace System;
+using namespace System::IO;
+
+namespace librocks::Net {
+
+    ref class KeyValueStore;
+
+    // Read-only, seekable view of a stored value. All reads go against the
+    // Snapshot taken when the stream was opened and copy only the requested
+    // range straight into the caller's buffer.
+    public ref class ValueReadStream sealed : public Stream
+    {
+        internal:
+            ValueReadStream(KeyValueStore^ owner, Kind^ kind, array<Byte>^ key, Snapshot^ snapshot, ReadOptions^ options,
+                Int64 length)
+                : _owner(owner), _kind(kind), _key(key), _snapshot(snapshot), _options(options), _length(length),
+                _position(0) {}
+
+        public:
+            ~ValueReadStream() {
+                if (_snapshot != nullptr) {
+                    delete _snapshot;
+                    _snapshot = nullptr;
+                }
+            }
+
+            property bool CanRead {
+                virtual bool get() override { return _snapshot != nullptr; }
+            }
+
+            property bool CanSeek {
+                virtual bool get() override { return _snapshot != nullptr; }
+            }
+
+            property bool CanWrite {
+                virtual bool get() override { return false; }
+            }
+
+            property Int64 Length {
+                virtual Int64 get() override {
+                    ThrowIfDisposed();
+                    return _length;
+                }
+            }
+
+            property Int64 Position {
+                virtual Int64 get() override {
+                    ThrowIfDisposed();
+                    return _position;
+                }
+                virtual void set(Int64 value) override {
+                    ThrowIfDisposed();
+                    if (value < 0) throw gcnew ArgumentOutOfRangeException("value");
+                    _position = value;
+                }
+            }
+
+            virtual int Read(array<Byte>^ buffer, int offset, int count) override;
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+            virtual int Read(Span<Byte> buffer) override;
+
+#pragma warning(pop)
+
+            virtual Int64 Seek(Int64 offset, SeekOrigin origin) override;
+
+            virtual void Flush() override {
+            }
+
+            virtual void SetLength(Int64) override {
+                throw gcnew NotSupportedException();
+            }
+
+            virtual void Write(array<Byte>^, int, int) override {
+                throw gcnew NotSupportedException();
+            }
+
+        private:
+            KeyValueStore^ _owner;
+            Kind^ _kind;
+            array<Byte>^ _key;
+            Snapshot^ _snapshot;
+            ReadOptions^ _options;
+            Int64 _length;
+            Int64 _position;
+
+            void ThrowIfDisposed() {
+                if (_snapshot == nullptr) {
+                    throw gcnew ObjectDisposedException("ValueReadStream");
+                }
+            }
+    };
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "pch.h"
+#include "ValueWriteStream.h"
+#include "KeyValueStore.h"
+
+namespace librocks::Net {
+
+    void ValueWriteStream::Write(array<Byte>^ buffer, int offset, int count)
+    {
+        if (buffer == nullptr) throw gcnew ArgumentNullException("buffer");
+        Write(ReadOnlySpan<Byte>(buffer, offset, count));
+    }
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+    void ValueWriteStream::Write(ReadOnlySpan<Byte> buffer)
+    {
+        ThrowIfDisposed();
+        if (buffer.Length == 0) return;
+
+        pin_ptr<const Byte> pChunk = &MemoryMarshal::GetReference(buffer);
+        std::string_view nativeChunkView(reinterpret_cast<const char*>(pChunk), buffer.Length);
+
+        try {
+            _nativePtr->append(nativeChunkView);
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during ValueWriteStream Write() operation.");
+        }
+    }
+
+#pragma warning(pop)
+
+    void ValueWriteStream::Commit()
+    {
+        ThrowIfDisposed();
+        // the native writer refers to the store, so it must still be open
+        if (!_owner->IsOpen) throw gcnew ObjectDisposedException("KeyValueStore");
+        try {
+            _nativePtr->commit();
+            _owner->RecordPerfSampleIfEnabled("CommitValue");
+        }
+        catch (RocksDbException^) {
+            throw;
+        }
+        catch (...) {
+            throw gcnew Exception("An unexpected error occurred during ValueWriteStream Commit() operation.");
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "client/ValueWriter.h"
+
+using namespace System;
+using namespace System::IO;
+
+namespace librocks::Net {
+
+    ref class KeyValueStore;
+
+    // Write-only stream that gathers a large value chunk by chunk in native
+    // memory (outside of the GC heap) and puts it with Commit(). Disposing
+    // the stream without a Commit() discards everything written so far.
+    // The value is written atomically, so peak native memory is the full value size.
+    public ref class ValueWriteStream sealed : public Stream
+    {
+        internal:
+            ValueWriteStream(KeyValueStore^ owner, ValueWriter* nativeWriter)
+                : _owner(owner), _nativePtr(nativeWriter) {}
+
+        public:
+            ~ValueWriteStream() { this->!ValueWriteStream(); }
+
+        protected:
+            // Finalizer
+            !ValueWriteStream() {
+                if (_nativePtr) {
+                    delete _nativePtr;
+                    _nativePtr = nullptr;
+                }
+            }
+
+        public:
+            void Commit();
+
+            property bool IsCommitted {
+                bool get() {
+                    ThrowIfDisposed();
+                    return _nativePtr->isCommitted();
+                }
+            }
+
+            property bool CanRead {
+                virtual bool get() override { return false; }
+            }
+
+            property bool CanSeek {
+                virtual bool get() override { return false; }
+            }
+
+            property bool CanWrite {
+                virtual bool get() override { return _nativePtr != nullptr && !_nativePtr->isCommitted(); }
+            }
+
+            property Int64 Length {
+                virtual Int64 get() override {
+                    ThrowIfDisposed();
+                    return static_cast<Int64>(_nativePtr->size());
+                }
+            }
+
+            property Int64 Position {
+                virtual Int64 get() override {
+                    ThrowIfDisposed();
+                    return static_cast<Int64>(_nativePtr->size());
+                }
+                virtual void set(Int64) override {
+                    throw gcnew NotSupportedException();
+                }
+            }
+
+            virtual void Write(array<Byte>^ buffer, int offset, int count) override;
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+            virtual void Write(ReadOnlySpan<Byte> buffer) override;
+
+#pragma warning(pop)
+
+            virtual void Flush() override {
+            }
+
+            virtual int Read(array<Byte>^, int, int) override {
+                throw gcnew NotSupportedException();
+            }
+
+            virtual Int64 Seek(Int64, SeekOrigin) override {
+                throw gcnew NotSupportedException();
+            }
+
+            virtual void SetLength(Int64) override {
+                throw gcnew NotSupportedException();
+            }
+
+        private:
+            KeyValueStore^ _owner;
+            ValueWriter* _nativePtr;
+
+            void ThrowIfDisposed() {
+                if (_nativePtr == nullptr) {
+                    throw gcnew ObjectDisposedException("ValueWriteStream");
+                }
+            }
+    };
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "api/WriteOptions.h"
+
+using namespace System;
+
+namespace librocks::Net {
+
+    // Per-write durability and priority settings. A default-constructed
+    // instance behaves like the overloads that don't take WriteOptions.
+    public ref class WriteOptions sealed
+    {
+        public:
+            WriteOptions() {
+                ::WriteOptions defaults;
+                DisableWal = defaults.disableWAL;
+                Sync = defaults.sync;
+                LowPriority = defaults.lowPri;
+                IgnoreMissingKinds = defaults.ignoreMissingKinds;
+            }
+
+            // The write is lost if the process crashes before the next flush
+            property bool DisableWal;
+
+            // Fsync the WAL before the call returns
+            property bool Sync;
+
+            // Throttle this write first if compactions are falling behind
+            property bool LowPriority;
+
+            // Silently ignore writes to a Kind that has been dropped
+            property bool IgnoreMissingKinds;
+
+        internal:
+            ::WriteOptions ToNative() {
+                ::WriteOptions options;
+                options.disableWAL = DisableWal;
+                options.sync = Sync;
+                options.lowPri = LowPriority;
+                options.ignoreMissingKinds = IgnoreMissingKinds;
+                return options;
+            }
+    };
+}
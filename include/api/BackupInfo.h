@@ -0,0 +1,13 @@
+#pragma once
+
+struct BackupInfo {
+    // ids start at 1 and increase with every backup in a backup directory
+    unsigned int backupId = 0;
+    // seconds since the Unix epoch
+    unsigned long long timestamp = 0;
+    unsigned int numFiles = 0;
+    // total size of the files that make up the backup
+    unsigned long long size = 0;
+    // the part of size that had to be copied, the rest is shared with earlier backups
+    unsigned long long bytesCopied = 0;
+};
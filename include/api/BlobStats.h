@@ -0,0 +1,8 @@
+#pragma once
+
+struct BlobStats {
+    unsigned long long numFiles = 0;
+    unsigned long long totalFileSize = 0;
+    unsigned long long liveFileSize = 0;
+    unsigned long long garbageSize = 0;
+};
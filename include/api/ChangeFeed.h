@@ -0,0 +1,54 @@
+#pragma once
+
+#include "api/api.h"
+#include "api/Kind.h"
+
+namespace ChangeType {
+    constexpr int Put = 0;
+    constexpr int Remove = 1;
+    constexpr int SingleRemove = 2;
+    // key is the begin (inclusive) and value the end key (exclusive) of the range
+    constexpr int RemoveRange = 3;
+    constexpr int Merge = 4;
+}
+
+struct ChangeRecord {
+    const Kind* kind;
+    int type;
+    const char* key;
+    size_t keyLen;
+    // nullptr / 0 for removals
+    const char* value;
+    size_t valLen;
+};
+
+// The records of one committed write batch in the order they were written.
+// The records (and the memory they point to) are owned by the batch.
+struct LIBROCKS_API ChangeBatch {
+
+    // sequence number of the first record, the following records have consecutive numbers
+    virtual unsigned long long sequenceNumber() const noexcept = 0;
+
+    virtual size_t size() const noexcept = 0;
+
+    virtual const ChangeRecord& record(size_t i) const noexcept = 0;
+
+    virtual ~ChangeBatch() = default;
+};
+
+// Tails the WAL starting at a sequence number. Records of Kinds that have
+// been dropped in the meantime are skipped.
+struct LIBROCKS_API ChangeFeed {
+
+    // returns nullptr (with status Ok) once the feed has caught up with the last committed
+    // write, a later call picks up what has been written since; status is NotFound if the
+    // WAL file that holds the position has already been deleted (see StoreOptions::walRetentionSeconds)
+    [[nodiscard("return value must be deleted")]]
+    virtual ChangeBatch* next(int* status) noexcept = 0;
+
+    // sequence number of the first write that the next call of next() returns, a
+    // consumer that persists it can resume with Store::openChangeFeed() from there
+    virtual unsigned long long position() const noexcept = 0;
+
+    virtual ~ChangeFeed() = default;
+};
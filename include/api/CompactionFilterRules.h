@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+// Built-in retention rules of a Kind's native compaction filter. An entry
+// is dropped when compaction encounters it and any of the rules matches.
+// All arrays are copied, they only need to outlive the call that passes them.
+struct CompactionFilterRules {
+    const char* const* dropKeyPrefixes = nullptr;
+    const size_t* dropKeyPrefixLens = nullptr;
+    size_t numDropKeyPrefixes = 0;
+
+    const char* const* dropValuePrefixes = nullptr;
+    const size_t* dropValuePrefixLens = nullptr;
+    size_t numDropValuePrefixes = 0;
+
+    // a big-endian unsigned timestamp of timestampWidth (4 or 8) bytes at timestampOffset
+    // of the key (or the value), entries with a timestamp < timestampCutoff are dropped
+    bool timestampInValue = false;
+    size_t timestampOffset = 0;
+    unsigned int timestampWidth = 8;
+    unsigned long long timestampCutoff = 0;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+#include "api/api.h"
+
+struct LIBROCKS_API CompactionJob {
+
+    virtual bool isDone() const noexcept = 0;
+
+    // Incomplete while running, Ok when finished, Aborted when cancelled
+    virtual int status() const noexcept = 0;
+
+    virtual unsigned long long bytesRead() const noexcept = 0;
+
+    virtual unsigned long long bytesWritten() const noexcept = 0;
+
+    virtual unsigned long long filesIn() const noexcept = 0;
+
+    virtual unsigned long long filesOut() const noexcept = 0;
+
+    virtual void cancel() noexcept = 0;
+
+    // returns isDone()
+    virtual bool await(std::chrono::milliseconds timeout) noexcept = 0;
+
+    // deleting a job that is still running cancels it
+    virtual ~CompactionJob() = default;
+};
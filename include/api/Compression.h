@@ -0,0 +1,13 @@
+#pragma once
+
+// same values as rocksdb::CompressionType
+namespace Compression {
+    constexpr int None = 0;
+    constexpr int Snappy = 1;
+    constexpr int Zlib = 2;
+    constexpr int BZip2 = 3;
+    constexpr int LZ4 = 4;
+    constexpr int LZ4HC = 5;
+    constexpr int Xpress = 6;
+    constexpr int ZSTD = 7;
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "api/api.h"
+#include "api/Kind.h"
+#include "api/KindOptions.h"
+#include "api/ReadOptions.h"
+#include "api/WriteOptions.h"
+#include "api/BackupInfo.h"
+#include "api/BlobStats.h"
+#include "api/MemoryUsage.h"
+#include "api/PerfSample.h"
+#include "api/ChangeFeed.h"
+#include "api/CompactionFilterRules.h"
+#include "api/RateLimits.h"
+#include "api/RecoveryReport.h"
+#include "api/CompactionJob.h"
+#include "api/Snapshot.h"
+#include "api/SstWriter.h"
+
+// Everything a Store offers beyond the original Store, ExtendedOps and KindManager
+// interfaces. Those are frozen: callers dispatch through their vtables and MSVC lays
+// out the overloads of a name next to each other, so a method added anywhere in them
+// would move the slots of the existing ones. New methods are only ever appended at
+// the end of this interface, under a name that isn't used in it yet.
+//
+// Obtained with getExtendedStore(), it belongs to its Store and must not be deleted.
+struct LIBROCKS_API ExtendedStore {
+
+    [[nodiscard("return value must be released with releaseSnapshot()")]]
+    virtual const Snapshot* getSnapshot(int* status) noexcept = 0;
+
+    virtual void releaseSnapshot(const Snapshot* snapshot) noexcept = 0;
+
+    [[nodiscard("return value must be delete[]d")]]
+    // snapshot may be nullptr
+    virtual char* get(int* status, const Kind& kind, const ReadOptions& options, const Snapshot* snapshot,
+        size_t* resultLen, const char* key, size_t keyLen) const noexcept = 0;
+
+    // statuses[i] receives Ok or NotFound (or an error) for keys[i]
+    [[nodiscard("return value and each of its elements must be delete[]d")]]
+    virtual char** multiGet(int* status, const Kind& kind, const ReadOptions& options, const Snapshot* snapshot,
+        size_t numKeys, const char* const* keys, const size_t* keyLens, size_t* resultLens,
+        int* statuses) const noexcept = 0;
+
+    [[nodiscard("return value must be deleted")]]
+    virtual SstWriter* createSstWriter(int* status, const Kind& kind) noexcept = 0;
+
+    // moveFiles: hard-link the files into the store instead of copying them
+    virtual void ingest(int* status, const Kind& kind, const char* const* filePaths, size_t numFiles,
+        bool moveFiles) noexcept = 0;
+
+    // a nullptr beginKey / endKey means unbounded on that side, a targetLevel < 0
+    // keeps the files on their level and maxSubcompactions == 0 uses the store default
+    [[nodiscard("return value must be deleted")]]
+    virtual CompactionJob* compactRange(int* status, const Kind& kind, const char* beginKeyInclusive,
+        size_t beginKeyLen, const char* endKeyExclusive, size_t endKeyLen, int targetLevel,
+        unsigned int maxSubcompactions) noexcept = 0;
+
+    // drops all SST files that lie completely inside the range, then removeRange()s
+    // what is left at the edges and optionally compacts the two boundary ranges
+    virtual void purgeRange(int* status, const Kind& kind, const WriteOptions& options,
+        const char* beginKeyInclusive, size_t beginKeyLen, const char* endKeyExclusive, size_t endKeyLen,
+        bool compactBoundaries) noexcept = 0;
+
+    // estimated from SST file metadata and memtable statistics, no data blocks are read
+    virtual void approximateSize(int* status, const Kind& kind, const char* beginKeyInclusive, size_t beginKeyLen,
+        const char* endKeyExclusive, size_t endKeyLen, unsigned long long* onDiskBytes,
+        unsigned long long* memtableBytes) const noexcept = 0;
+
+    virtual unsigned long long estimateNumKeys(int* status, const Kind& kind) const noexcept = 0;
+
+    // probes keyMayExist() (memtables and bloom filters) first and
+    // only falls back to an exact lookup if the key may exist
+    virtual bool contains(int* status, const Kind& kind, const char* key, size_t keyLen) const noexcept = 0;
+
+    // the value is pinned in place and never copied, status is NotFound if the key doesn't exist
+    virtual size_t valueSize(int* status, const Kind& kind, const char* key, size_t keyLen) const noexcept = 0;
+
+    // copies up to destLen bytes of the value starting at offset into dest and returns the number
+    // of bytes copied, valueSize receives the full value length (status is NotFound if absent)
+    virtual size_t readRange(int* status, const Kind& kind, const ReadOptions& options, const Snapshot* snapshot,
+        const char* key, size_t keyLen, size_t offset, char* dest, size_t destLen,
+        size_t* valueSize) const noexcept = 0;
+
+    virtual const Kind& getOrCreateKind(int* status, const char* kindName, const KindOptions& options) noexcept = 0;
+
+    virtual KindOptions getKindOptions(int* status, const Kind& kind) const noexcept = 0;
+
+    virtual BlobStats getBlobStats(int* status, const Kind& kind) const noexcept = 0;
+
+    // the entry is hidden from reads and dropped by compaction once expiresAtMillis (milliseconds
+    // since the Unix epoch) has passed, status is NotSupported unless the Kind has perEntryExpiry
+    virtual void putWithExpiry(int* status, const Kind& kind, const WriteOptions& options, const char* key,
+        size_t keyLen, const char* value, size_t valLen, unsigned long long expiresAtMillis) noexcept = 0;
+
+    // replaces the rules of the Kind's compaction filter, it takes effect with the next compaction
+    virtual void setCompactionFilter(int* status, const Kind& kind, const CompactionFilterRules& rules) noexcept = 0;
+
+    virtual void clearCompactionFilter(int* status, const Kind& kind) noexcept = 0;
+
+    virtual bool hasCompactionFilter(int* status, const Kind& kind) const noexcept = 0;
+
+    // can be changed at any time
+    virtual void setRateLimits(int* status, const RateLimits& limits) noexcept = 0;
+
+    virtual RateLimits getRateLimits(int* status) const noexcept = 0;
+
+    // the ExtendedOps mutations with per-call WriteOptions
+
+    virtual void put(int* status, const Kind& kind, const WriteOptions& options, const char* key, size_t keyLen,
+        const char* value, size_t valLen) noexcept = 0;
+
+    virtual void remove(int* status, const Kind& kind, const WriteOptions& options, const char* key,
+        size_t keyLen) noexcept = 0;
+
+    [[nodiscard("return value must be delete[]d")]]
+    virtual char* updateIfPresent(int* status, const Kind& kind, const WriteOptions& options, size_t* resultLen,
+        const char* key, size_t keyLen, const char* value, size_t valLen) noexcept = 0;
+
+    virtual void singleRemove(int* status, const Kind& kind, const WriteOptions& options, const char* key,
+        size_t keyLen) noexcept = 0;
+
+    [[nodiscard("return value must be delete[]d")]]
+    virtual char* singleRemoveIfPresent(int* status, const Kind& kind, const WriteOptions& options,
+        size_t* resultLen, const char* key, size_t keyLen) noexcept = 0;
+
+    [[nodiscard("return value must be delete[]d")]]
+    virtual char* removeIfPresent(int* status, const Kind& kind, const WriteOptions& options, size_t* resultLen,
+        const char* key, size_t keyLen) noexcept = 0;
+
+    virtual void putIfAbsent(int* status, const Kind& kind, const WriteOptions& options, const char* key,
+        size_t keyLen, const char* value, size_t valLen) noexcept = 0;
+
+    virtual void removeRange(int* status, const Kind& kind, const WriteOptions& options,
+        const char* beginKeyInclusive, size_t beginKeyLen, const char* endKeyExclusive,
+        size_t endKeyLen) noexcept = 0;
+
+    // the ExtendedOps lookups with per-call ReadOptions
+
+    [[nodiscard("return value must be delete[]d")]]
+    virtual char* findMinKey(int* status, const Kind& kind, const ReadOptions& options,
+        size_t* resultLen) const noexcept = 0;
+
+    [[nodiscard("return value must be delete[]d")]]
+    virtual char* findMaxKey(int* status, const Kind& kind, const ReadOptions& options,
+        size_t* resultLen) const noexcept = 0;
+
+    virtual MemoryUsage memoryUsage(int* status) const noexcept = 0;
+
+    // resets and enables the PerfContext/IOStatsContext of the calling thread, this
+    // slows down the thread's operations and should only be used for sampled calls
+    virtual void beginPerfCapture() noexcept = 0;
+
+    // disables the calling thread's capture and returns what it collected
+    virtual PerfSample endPerfCapture() noexcept = 0;
+
+    // true for stores opened with openStoreReadOnly or openStoreSecondary
+    virtual bool isReadOnly() const noexcept = 0;
+
+    // catches up with the primary's MANIFEST and WAL, status is NotSupported unless
+    // the store was opened with openStoreSecondary
+    virtual void tryCatchUpWithPrimary(int* status) noexcept = 0;
+
+    // the sequence number of the last committed write
+    virtual unsigned long long latestSequenceNumber() const noexcept = 0;
+
+    // streams the committed write batches starting with the one that contains fromSequenceNumber,
+    // status is NotFound if the WAL has already been deleted up to there
+    [[nodiscard("return value must be deleted")]]
+    virtual ChangeFeed* openChangeFeed(int* status, unsigned long long fromSequenceNumber) noexcept = 0;
+
+    // creates an openable copy of the store in dir (which must not exist yet) without blocking
+    // writes: the immutable SST and blob files are hard-linked (copied if dir is on another
+    // filesystem), only the live WAL, the MANIFEST and the OPTIONS file are copied
+    virtual void createCheckpoint(int* status, const char* dir) noexcept = 0;
+
+    // adds a backup to backupDir (created if necessary) that only copies the SST and blob
+    // files which no earlier backup in backupDir contains; flushing the memtables first
+    // makes the backup independent of the WAL
+    virtual BackupInfo createBackup(int* status, const char* backupDir, bool flushBeforeBackup) noexcept = 0;
+
+    // the report of the open that created the store, lazily opened Kinds that have been
+    // requested since then are included in tableFilesLoaded
+    virtual RecoveryReport recoveryReport() const noexcept = 0;
+
+    // copies up to capacity Kinds into kinds without allocating and returns the total
+    // number of Kinds, which may be larger than capacity
+    virtual size_t getKinds(int* status, const Kind** kinds, size_t capacity) const noexcept = 0;
+
+    // puts the concatenation of the numParts parts as the value, the parts are copied straight
+    // into the write batch (SliceParts) without being joined into one buffer first
+    virtual void putParts(int* status, const Kind& kind, const WriteOptions& options, const char* key, size_t keyLen,
+        const char* const* parts, const size_t* partLens, size_t numParts) noexcept = 0;
+
+protected:
+    ~ExtendedStore() = default;
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "api/Compression.h"
+
+// Key-value separation (integrated BlobDB): values of at least minBlobSize
+// bytes are written to blob files and compaction only rewrites the keys.
+// Except for perEntryExpiry all of these options can be changed for an
+// already existing Kind.
+struct KindOptions {
+    bool enableBlobFiles = false;
+    unsigned long long minBlobSize = 0;
+    int blobCompression = Compression::None;
+    bool enableBlobGarbageCollection = false;
+    // fraction of the oldest blob files that garbage collection relocates
+    double blobGarbageCollectionAgeCutoff = 0.25;
+    // entries older than ttlSeconds are hidden from reads and dropped by a
+    // compaction filter, 0 disables the TTL
+    unsigned long long ttlSeconds = 0;
+    // store an expiry timestamp with every entry (see Store::putWithExpiry()).
+    // This changes the value format, so unlike the other options it can only
+    // be chosen when the Kind gets created
+    bool perEntryExpiry = false;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+struct MemoryUsage {
+    // active and immutable memtables of all Kinds
+    unsigned long long memtables = 0;
+    // total block cache usage (includes the memtable charge if a write buffer limit is set)
+    unsigned long long blockCache = 0;
+    // block cache entries that are pinned and can't be evicted
+    unsigned long long blockCachePinned = 0;
+    // index and filter blocks held by the table readers outside of the block cache
+    unsigned long long indexAndFilterBlocks = 0;
+    // the Store doesn't know when its result buffers get delete[]d, so the two
+    // fields below are always 0 from Store::memoryUsage() and filled in by KVStore
+    unsigned long long readCache = 0;
+    unsigned long long liveResultBuffers = 0;
+};
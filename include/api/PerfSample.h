@@ -0,0 +1,25 @@
+#pragma once
+
+// subset of RocksDB's PerfContext and IOStatsContext for a single operation
+struct PerfSample {
+    unsigned long long blockReadCount = 0;
+    unsigned long long blockReadBytes = 0;
+    unsigned long long blockReadNanos = 0;
+    unsigned long long blockCacheHitCount = 0;
+    unsigned long long blockDecompressNanos = 0;
+    // SST bloom filter checks that did / didn't rule out the file
+    unsigned long long bloomSstMissCount = 0;
+    unsigned long long bloomSstHitCount = 0;
+    unsigned long long getFromMemtableNanos = 0;
+    unsigned long long getFromOutputFilesNanos = 0;
+    unsigned long long dbMutexLockNanos = 0;
+    unsigned long long dbConditionWaitNanos = 0;
+    unsigned long long writeWalNanos = 0;
+    unsigned long long writeMemtableNanos = 0;
+    unsigned long long writeDelayNanos = 0;
+    unsigned long long fileReadNanos = 0;
+    unsigned long long fileBytesRead = 0;
+    unsigned long long fsyncNanos = 0;
+    // wall-clock time of the whole operation, filled in by the caller of endPerfCapture()
+    unsigned long long elapsedNanos = 0;
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+// Background I/O budgets in bytes per second, 0 means unlimited. With
+// autoTune the limiter adapts the budgets within those upper bounds to
+// the actual demand.
+struct RateLimits {
+    unsigned long long flushBytesPerSec = 0;
+    unsigned long long compactionBytesPerSec = 0;
+    bool autoTune = false;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+// the default-constructed value gives the same behavior as the overloads without ReadOptions
+struct ReadOptions {
+    // false keeps bulk reads from evicting the working set from the block cache
+    bool fillCache = true;
+    // 0 lets RocksDB pick an adaptive readahead size
+    size_t readaheadSize = 0;
+    bool asyncIo = false;
+    bool verifyChecksums = true;
+    // the read fails with Status::TimedOut once it has taken longer, 0 means no limit
+    unsigned long long timeoutMicros = 0;
+};
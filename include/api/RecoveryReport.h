@@ -0,0 +1,24 @@
+#pragma once
+
+// what opening a Store took, the phases of a parallel open overlap so the
+// phase timings don't add up to totalMicros
+struct RecoveryReport {
+    unsigned long long totalMicros = 0;
+    // reading the MANIFEST and opening the Kinds (column families)
+    unsigned long long manifestMicros = 0;
+    // replaying the WAL files into the memtables
+    unsigned long long walReplayMicros = 0;
+    // opening the table files and loading their index and filter blocks
+    unsigned long long tableLoadMicros = 0;
+    unsigned int walFilesReplayed = 0;
+    unsigned long long walBytesReplayed = 0;
+    unsigned long long walRecordsReplayed = 0;
+    unsigned int tableFilesLoaded = 0;
+    // total number of table files, the difference to tableFilesLoaded is deferred to first use
+    unsigned int tableFiles = 0;
+    unsigned int kindsOpened = 0;
+    // Kinds whose table files are only opened on their first getOrCreateKind() (see StoreOptions::lazyKindOpening)
+    unsigned int kindsDeferred = 0;
+    // true once the open has completed, progress callbacks see false
+    bool completed = false;
+};
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "api/api.h"
+
+struct LIBROCKS_API Snapshot {
+
+    virtual unsigned long long sequenceNumber() const noexcept = 0;
+
+    virtual ~Snapshot() = default;
+};
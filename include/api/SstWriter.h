@@ -0,0 +1,20 @@
+#pragma once
+
+#include "api/api.h"
+
+// Keys must be put in strictly ascending order (with respect to the
+// comparator of the Kind the writer was created for).
+struct LIBROCKS_API SstWriter {
+
+    virtual void open(int* status, const char* filePath) noexcept = 0;
+
+    virtual void put(int* status, const char* key, size_t keyLen, const char* value, size_t valLen) noexcept = 0;
+
+    virtual void finish(int* status) noexcept = 0;
+
+    virtual unsigned long long fileSize() const noexcept = 0;
+
+    virtual unsigned long long numEntries() const noexcept = 0;
+
+    virtual ~SstWriter() = default;
+};
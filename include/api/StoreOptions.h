@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include "api/RecoveryReport.h"
+
+// open-time settings of a Store, the defaults match openStore()
+struct StoreOptions {
+    // O_DIRECT for user reads, bypasses the OS page cache (the block cache does the caching)
+    bool useDirectReads = false;
+    // O_DIRECT for the reads and writes of flushes and compactions
+    bool useDirectIoForFlushAndCompaction = false;
+    // mmap SST files for read-mostly stores, can't be combined with useDirectReads
+    bool allowMmapReads = false;
+    // readahead of compaction inputs in bytes, 0 uses the RocksDB default
+    size_t compactionReadaheadSize = 0;
+    // capacity of the block cache shared by all Kinds, 0 uses the RocksDB default
+    size_t blockCacheCapacity = 0;
+    // single cap on the memtable memory of all Kinds (including the ones created later with
+    // getOrCreateKind()), charged against the block cache so that blockCacheCapacity bounds
+    // both; 0 gives every Kind its own unbounded set of write buffers
+    size_t writeBufferLimit = 0;
+    // keeps flushed WAL files for this long so that change feeds can resume from older
+    // positions, 0 deletes them as soon as they are no longer needed for recovery
+    unsigned long long walRetentionSeconds = 0;
+    // threads that replay the WAL files of the Kinds and open the table files in parallel
+    // during open, 0 uses one per hardware thread and 1 opens sequentially
+    unsigned int recoveryThreads = 0;
+    // the table files of a Kind are only opened (and their index and filter blocks loaded)
+    // when the Kind is first requested with getOrCreateKind(), instead of during open
+    bool lazyKindOpening = false;
+    // replays the WAL into the memtables without flushing them at the end of the recovery,
+    // faster but keeps the replayed WAL files around until the next regular flush
+    bool avoidFlushDuringRecovery = false;
+    // skips reading the table properties of every file for the key count and size statistics
+    bool skipStatsUpdateOnOpen = false;
+    // called from the opening thread as the recovery advances (after every WAL file and every
+    // batch of table files) with the report so far, context is passed through unchanged
+    void (*recoveryProgress)(void* context, const RecoveryReport& progress) noexcept = nullptr;
+    void* recoveryProgressContext = nullptr;
+};
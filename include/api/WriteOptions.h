@@ -0,0 +1,15 @@
+#pragma once
+
+// the default-constructed value gives the same behavior as the overloads without WriteOptions
+struct WriteOptions {
+    // skip the WAL, the write is lost on a crash before the next flush
+    bool disableWAL = false;
+    // fsync the WAL before returning
+    bool sync = false;
+    // throttle this write first if compactions are falling behind
+    bool lowPri = false;
+    // silently ignore the write if the Kind has been dropped
+    bool ignoreMissingKinds = false;
+    // fail with Status::Busy instead of stalling the caller when writes are being throttled
+    bool noSlowdown = false;
+};
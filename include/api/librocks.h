@@ -2,6 +2,8 @@
 
 #include "api/api.h"
 #include "api/Store.h"
+#include "api/ExtendedStore.h"
+#include "api/StoreOptions.h"
 #include "api/KueueManager.h"
 
 
@@ -12,6 +14,34 @@ extern "C" {
 [[nodiscard("return value must be closed and deleted")]]
 LIBROCKS_API Store* openStore(int* status, const char* path);
 
+// status is NotSupported if the filesystem can't do the requested I/O mode
+// (e.g. O_DIRECT on tmpfs) and InvalidArgument for contradictory options
+[[nodiscard("return value must be closed and deleted")]]
+LIBROCKS_API Store* openStoreWithOptions(int* status, const char* path, const StoreOptions* options);
+
+// opens an existing store without a write path (mutations fail with NotSupported) and
+// without taking the store's lock, so any number of processes can read it while the
+// primary keeps writing; the instance sees the data as of the time it was opened
+[[nodiscard("return value must be closed and deleted")]]
+LIBROCKS_API Store* openStoreReadOnly(int* status, const char* path, const StoreOptions* options);
+
+// like openStoreReadOnly, but Store::tryCatchUpWithPrimary() replays what the primary
+// has written since; secondaryPath is a private directory for the instance's own logs
+[[nodiscard("return value must be closed and deleted")]]
+LIBROCKS_API Store* openStoreSecondary(int* status, const char* path, const char* secondaryPath,
+    const StoreOptions* options);
+
+// restores the backup with backupId (0 for the latest one) from backupDir into restoreDir,
+// which must not contain a store that is open
+LIBROCKS_API void restoreBackup(int* status, const char* backupDir, unsigned int backupId, const char* restoreDir);
+
+// deletes all but the numToKeep latest backups in backupDir and the files only they used
+LIBROCKS_API void purgeOldBackups(int* status, const char* backupDir, unsigned int numToKeep);
+
+// the methods of store that aren't part of the original Store interface, the result
+// belongs to store and is valid as long as store hasn't been deleted
+LIBROCKS_API ExtendedStore* getExtendedStore(int* status, Store* store);
+
 [[nodiscard("return value must be closed and deleted")]]
 LIBROCKS_API KueueManager* openKueueManager(int* status, const char* path);
 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "api/ChangeFeed.h"
+
+class KVStore;
+
+struct Change {
+    const Kind* kind = nullptr;
+    // one of the ChangeType constants
+    int type = ChangeType::Put;
+    std::string key;
+    // the end key for ChangeType::RemoveRange, empty for the other removals
+    std::string value;
+};
+
+// the changes of one committed write batch
+struct ChangeSet {
+    unsigned long long sequenceNumber = 0;
+    std::vector<Change> changes;
+};
+
+// Reads the committed write batches of a KVStore from its WAL, in commit order
+class ChangeStream {
+public:
+
+    ChangeStream(const ChangeStream&) = delete;
+
+    ChangeStream& operator=(const ChangeStream&) = delete;
+
+    ~ChangeStream();
+
+    // returns up to maxBatches write batches, an empty vector means that the stream has caught up;
+    // an error is only thrown once the batches before it have been returned
+    std::vector<ChangeSet> poll(size_t maxBatches = 64);
+
+    // where the next poll() continues, persist it to resume with KVStore::openChangeStream()
+    unsigned long long position() const noexcept;
+
+    friend class KVStore;
+
+private:
+    explicit ChangeStream(ChangeFeed* pFeed) : feed(pFeed) {
+    }
+
+private:
+    ChangeFeed* feed;
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include "api/CompactionJob.h"
+
+class KVStore;
+
+class Compaction {
+public:
+
+    Compaction(const Compaction&) = delete;
+
+    Compaction& operator=(const Compaction&) = delete;
+
+    // cancels the compaction if it is still running and waits until it has stopped,
+    // so that the store can be closed right after
+    ~Compaction();
+
+    bool isDone() const noexcept;
+
+    bool isCancelled() const noexcept;
+
+    unsigned long long bytesRead() const noexcept;
+
+    unsigned long long bytesWritten() const noexcept;
+
+    unsigned long long filesIn() const noexcept;
+
+    unsigned long long filesOut() const noexcept;
+
+    void cancel() noexcept;
+
+    // returns true if the compaction has finished (or was cancelled)
+    // within timeout, throws if it has finished with an error
+    bool wait(std::chrono::milliseconds timeout);
+
+    friend class KVStore;
+
+private:
+    explicit Compaction(CompactionJob* pJob) : job(pJob) {
+    }
+
+private:
+    CompactionJob* job;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "api/Kind.h"
+
+struct HotKey {
+    // keys longer than HotKeyTracker::MAX_KEY_LENGTH are truncated
+    std::string key;
+    // estimated number of operations (the sampled count times the sample interval)
+    unsigned long long estimatedCount = 0;
+};
+
+struct HotKeyStats {
+    std::string kindName;
+    unsigned long long sampledReads = 0;
+    unsigned long long sampledWrites = 0;
+    // hottest first
+    std::vector<HotKey> readKeys;
+    std::vector<HotKey> writeKeys;
+    // empty unless prefix tracking is enabled
+    std::vector<HotKey> readPrefixes;
+    std::vector<HotKey> writePrefixes;
+};
+
+// Streaming heavy-hitter detection in fixed memory. Every n-th operation of
+// a thread on this tracker is counted in a count-min sketch (with conservative update) of
+// its Kind and access type, and the sketch estimate decides whether the key
+// enters that stream's top-k list. Optionally, key prefixes of a fixed
+// length are counted in the same way.
+//
+// Counts are halved once a stream has seen AGING_WINDOW samples, so the
+// lists follow shifts in the workload. At most MAX_KINDS Kinds are tracked,
+// the operations of any further Kinds are ignored.
+class HotKeyTracker {
+public:
+    static constexpr size_t MAX_KINDS = 64;
+    static constexpr size_t MAX_TOP_K = 64;
+    static constexpr size_t MAX_KEY_LENGTH = 128;
+    static constexpr unsigned long long AGING_WINDOW = 1ULL << 16;
+
+    // topK is clamped to [1, MAX_TOP_K], prefixLength 0 disables prefix tracking
+    HotKeyTracker(unsigned int sampleInterval, unsigned int topK, unsigned int prefixLength);
+
+    HotKeyTracker(const HotKeyTracker&) = delete;
+
+    HotKeyTracker& operator=(const HotKeyTracker&) = delete;
+
+    ~HotKeyTracker();
+
+    void record(const Kind& kind, std::string_view key, bool write) noexcept;
+
+    // one entry for every Kind that has been sampled since the last reset
+    std::vector<HotKeyStats> snapshot() const;
+
+    void reset() noexcept;
+
+private:
+    struct Slot;
+
+    Slot* slotFor(const Kind& kind) noexcept;
+
+    Slot* slots;
+    // keys the calling thread's sample countdown for this tracker
+    unsigned long long id;
+    unsigned int interval;
+    unsigned int topK;
+    unsigned int prefixLength;
+};
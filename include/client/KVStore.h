@@ -1,12 +1,29 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <map>
+#include <optional>
 #include <set>
 #include <string_view>
+#include <vector>
 #include "bytes.h"
+#include "KVStoreOptions.h"
+#include "ReadCache.h"
+#include "ReadCoalescer.h"
+#include "PerfSampler.h"
+#include "HotKeyTracker.h"
+#include "TraceRecorder.h"
+#include "TraceReplayer.h"
+#include "RetentionRules.h"
+#include "Compaction.h"
+#include "ChangeStream.h"
+#include "ValueWriter.h"
+#include "SstFileWriter.h"
 #include "api/Kind.h"
+#include "api/Snapshot.h"
 #include "api/Store.h"
+#include "api/ExtendedStore.h"
 
 using KindSet = std::set<std::reference_wrapper<const Kind>, bool(*)(const std::reference_wrapper<const Kind>&, const std::reference_wrapper<const Kind>&)>;
 
@@ -17,47 +34,224 @@ public:
 
     explicit KVStore(Store* store);
 
+    explicit KVStore(std::string_view path, const KVStoreOptions& options);
+
+    explicit KVStore(Store* store, const KVStoreOptions& options);
+
     ~KVStore();
 
-    void put(const Kind& kind, std::string_view key, std::string_view value);
+    // the store can be read while another process writes to it, see openStoreReadOnly
+    [[nodiscard("return value must be deleted")]]
+    static KVStore* openReadOnly(std::string_view path, const KVStoreOptions& options = KVStoreOptions());
+
+    // like openReadOnly, but tryCatchUpWithPrimary() picks up the primary's newer writes
+    [[nodiscard("return value must be deleted")]]
+    static KVStore* openSecondary(std::string_view path, std::string_view secondaryPath,
+        const KVStoreOptions& options = KVStoreOptions());
+
+    void put(const Kind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    // returns false (instead of stalling) if writes are currently being throttled, options.noSlowdown is implied
+    bool tryPut(const Kind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    // requires a Kind that was created with KindOptions::perEntryExpiry
+    void putWithExpiry(const Kind& kind, std::string_view key, std::string_view value,
+        std::chrono::system_clock::time_point expiresAt, const WriteOptions& options = WriteOptions());
 
-    void remove(const Kind& kind, std::string_view key);
+    void remove(const Kind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
 
     bytes get(const Kind& kind, std::string_view key) const;
 
-    bytes updateIfPresent(const Kind& kind, std::string_view key, std::string_view value);
+    bytes get(const Kind& kind, std::string_view key, const Snapshot& snapshot) const;
+
+    // served from the read cache if possible, but only fills it if options.fillCache is set
+    bytes get(const Kind& kind, std::string_view key, const ReadOptions& options,
+        const Snapshot* snapshot = nullptr) const;
+
+    // returns the (up to) length bytes of the value that start at offset, an empty result if offset is
+    // at or past the end of the value and a null (false) result only if the key doesn't exist
+    bytes get(const Kind& kind, std::string_view key, size_t offset, size_t length,
+        const ReadOptions& options = ReadOptions()) const;
+
+    // copies up to destLen bytes of the value starting at offset into dest and returns
+    // the number of bytes copied or std::nullopt if the key doesn't exist
+    std::optional<size_t> read(const Kind& kind, std::string_view key, size_t offset, char* dest, size_t destLen,
+        size_t* valueSize = nullptr, const Snapshot* snapshot = nullptr,
+        const ReadOptions& options = ReadOptions()) const;
+
+    [[nodiscard("return value must be deleted")]]
+    ValueWriter* createValueWriter(const Kind& kind, std::string_view key, size_t expectedSize = 0);
+
+    bool contains(const Kind& kind, std::string_view key) const;
+
+    std::optional<size_t> valueSize(const Kind& kind, std::string_view key) const;
 
-    void singleRemove(const Kind& kind, std::string_view key);
+    std::vector<bytes> multiGet(const Kind& kind, const std::vector<std::string_view>& keys,
+        const Snapshot* snapshot = nullptr, const ReadOptions& options = ReadOptions()) const;
 
-    bytes singleRemoveIfPresent(const Kind& kind, std::string_view key);
+    bytes updateIfPresent(const Kind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
 
-    bytes removeIfPresent(const Kind& kind, std::string_view key);
+    void singleRemove(const Kind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
 
-    bool putIfAbsent(const Kind& kind, std::string_view key, std::string_view value);
+    bytes singleRemoveIfPresent(const Kind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
 
-    bytes findMinKey(const Kind& kind) const;
+    bytes removeIfPresent(const Kind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
 
-    bytes findMaxKey(const Kind& kind) const;
+    bool putIfAbsent(const Kind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    bytes findMinKey(const Kind& kind, const ReadOptions& options = ReadOptions()) const;
+
+    bytes findMaxKey(const Kind& kind, const ReadOptions& options = ReadOptions()) const;
+
+    // here and for purgeRange() and approximateSize() a default-constructed (null) key view means
+    // unbounded on that side, while an empty view that isn't null is the empty key
+    void removeRange(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+        const WriteOptions& options = WriteOptions());
+
+    void purgeRange(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+        bool compactBoundaries = false, const WriteOptions& options = WriteOptions());
 
     void close();
 
     bool isOpen() const noexcept;
 
+    bool isReadOnly() const noexcept;
+
+    // also drops the read cache, which may hold values that the primary has overwritten since
+    void tryCatchUpWithPrimary();
+
     const Kind& getDefaultKind() const;
 
     const Kind& getOrCreateKind(std::string_view kindName);
 
+    const Kind& getOrCreateKind(std::string_view kindName, const KindOptions& options);
+
     const KindSet getKinds() const;
 
+    KindOptions getKindOptions(const Kind& kind) const;
+
+    unsigned long long approximateSize(const Kind& kind, std::string_view beginKeyInclusive,
+        std::string_view endKeyExclusive) const;
+
+    void approximateSize(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+        unsigned long long& onDiskBytes, unsigned long long& memtableBytes) const;
+
+    unsigned long long estimateNumKeys(const Kind& kind) const;
+
+    BlobStats getBlobStats(const Kind& kind) const;
+
+    // liveResultBuffers is process-wide, it covers the results of all KVStores
+    MemoryUsage memoryUsage() const;
+
+    // timings and counts of the open, see StoreOptions::recoveryThreads and lazyKindOpening
+    RecoveryReport recoveryReport() const noexcept;
+
     void compact(const Kind& kind);
 
     void compactAll();
 
+    // all zero if the read cache is disabled
+    ReadCacheStats getReadCacheStats() const noexcept;
+
+    // number of gets that were served by another thread's in-flight lookup
+    unsigned long long getCoalescedReadCount() const noexcept;
+
+    // returns true (once) if the calling thread's last operation was sampled
+    static bool takePerfSample(PerfSample* sample) noexcept;
+
+    // the hottest keys per Kind since the last reset, empty unless hot key detection is enabled
+    std::vector<HotKeyStats> getHotKeys() const;
+
+    void resetHotKeys() noexcept;
+
+    // trace records that were dropped because a thread's trace buffer was full
+    unsigned long long getDroppedTraceRecords() const noexcept;
+
+    // re-executes a trace recorded with KVStoreOptions::traceFile against a fresh store at storePath,
+    // which must not exist yet
+    static TraceReplayReport replayTrace(std::string_view tracePath, std::string_view storePath, double speedup = 1.0);
+
+    void setRateLimits(const RateLimits& limits);
+
+    RateLimits getRateLimits() const;
+
+    void setCompactionFilter(const Kind& kind, const RetentionRules& rules);
+
+    void clearCompactionFilter(const Kind& kind);
+
+    // runs in the background, a default-constructed (null) key view means unbounded
+    [[nodiscard("return value must be deleted")]]
+    Compaction* compactRange(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+        int targetLevel = -1, unsigned int maxSubcompactions = 0);
+
+    [[nodiscard("return value must be released with releaseSnapshot()")]]
+    const Snapshot* getSnapshot();
+
+    void releaseSnapshot(const Snapshot* snapshot) noexcept;
+
+    // hard links the table files, so it takes well under a second regardless of the store's size
+    void createCheckpoint(std::string_view dir);
+
+    // incremental, only the table files that aren't in backupDir yet are copied
+    BackupInfo createBackup(std::string_view backupDir, bool flushBeforeBackup = true);
+
+    // backupId 0 restores the latest backup
+    static void restoreBackup(std::string_view backupDir, std::string_view restoreDir, unsigned int backupId = 0);
+
+    static void purgeOldBackups(std::string_view backupDir, unsigned int numToKeep);
+
+    unsigned long long latestSequenceNumber() const noexcept;
+
+    // tails the WAL from fromSequenceNumber, use latestSequenceNumber() + 1 for only the changes from now on
+    [[nodiscard("return value must be deleted")]]
+    ChangeStream* openChangeStream(unsigned long long fromSequenceNumber);
+
+    [[nodiscard("return value must be deleted")]]
+    SstFileWriter* createSstFileWriter(const Kind& kind);
+
+    void ingest(const Kind& kind, const std::vector<std::string>& filePaths, bool moveFiles = true);
+
 private:
     Store* store;
+    // the methods that came after the original Store interface
+    ExtendedStore* extended;
+    ReadCache* cache;
+    ReadCoalescer* coalescer;
+    PerfSampler* sampler;
+    TraceRecorder* tracer;
+    HotKeyTracker* hotKeys;
 
 private:
+    friend class SstFileWriter;
+    friend class Compaction;
+    friend class ChangeStream;
+    friend class ValueWriter;
+    friend class ShardedKVStore;
     static const std::map<int, std::string> codes;
     static bool throwForStatus(int status);
     KindManager& getKindManager() const;
+    void init(const KVStoreOptions& options);
+    void release() noexcept;
+    std::shared_ptr<const char[]> loadShared(const Kind& kind, std::string_view key, const ReadOptions& options,
+        size_t* resultLen, int* status) const;
+    // for ValueWriter::commit()
+    void putParts(const Kind& kind, std::string_view key, const std::vector<std::string_view>& parts,
+        const WriteOptions& options);
+    bool isCacheable(const Kind& kind) const noexcept;
+    bool allowsCaching(const Kind& kind) const noexcept;
+    void invalidate(const Kind& kind, std::string_view key) noexcept;
+    void invalidate(const Kind& kind) noexcept;
+    // per-operation instrumentation, a single branch each if disabled
+    void observe(TraceOp op, const Kind& kind, std::string_view key, size_t valueSize) const noexcept {
+        if (tracer) {
+            tracer->record(op, kind, key, valueSize);
+        }
+        if (hotKeys) {
+            hotKeys->record(kind, key, !(op == TraceOp::Get || op == TraceOp::Contains));
+        }
+    }
 };
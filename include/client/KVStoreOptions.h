@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "api/StoreOptions.h"
+
+enum class OpenMode {
+    ReadWrite,
+    // see openStoreReadOnly
+    ReadOnly,
+    // see openStoreSecondary, requires KVStoreOptions::secondaryPath
+    Secondary
+};
+
+struct KVStoreOptions {
+    // byte budget of the in-process read cache, 0 disables the cache
+    size_t readCacheCapacity = 0;
+    // the read cache (and the read coalescer) are split into 2^readCacheShardBits independently locked shards
+    unsigned int readCacheShardBits = 4;
+    // concurrent gets of the same key share a single lookup and its result buffer
+    bool coalesceReads = false;
+    // capture the RocksDB perf context of every n-th operation per thread, 0 disables sampling
+    unsigned int perfSampleInterval = 0;
+    // records a binary trace of all point operations (see TraceRecorder) if not empty,
+    // the file is complete once the KVStore has been destroyed
+    std::string traceFile;
+    // count every n-th read and write per thread for hot key detection (see HotKeyTracker), 0 disables it
+    unsigned int hotKeySampleInterval = 0;
+    // length of the hot key lists per Kind and access type
+    unsigned int hotKeyTopK = 16;
+    // also detect hot key prefixes of this length, 0 disables prefix tracking
+    unsigned int hotKeyPrefixLength = 0;
+    // only used when the KVStore opens the Store itself
+    OpenMode openMode = OpenMode::ReadWrite;
+    std::string secondaryPath;
+    // I/O modes of the underlying Store (only used when the KVStore opens the Store itself)
+    StoreOptions storeOptions;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "api/PerfSample.h"
+#include "api/ExtendedStore.h"
+
+// Picks every n-th operation of a thread on this sampler's store for a PerfContext/IOStatsContext
+// capture. The captured sample is handed back to the caller through a
+// thread-local slot, so sampling shares no state between threads.
+class PerfSampler {
+public:
+
+    explicit PerfSampler(unsigned int interval) noexcept;
+
+    // also drops a sample of an earlier operation that nobody took
+    bool shouldSample() const noexcept;
+
+    static void publish(const PerfSample& sample) noexcept;
+
+    // moves the sample of the calling thread's last operation (if it was sampled) into *sample
+    static bool take(PerfSample* sample) noexcept;
+
+private:
+    // keys the calling thread's sample countdown for this sampler
+    unsigned long long id;
+    unsigned int interval;
+};
+
+// Captures the calling thread's perf context for the lifetime of the scope
+// if the operation is sampled. Without a sampler this is a single branch.
+class PerfScope {
+public:
+
+    PerfScope(ExtendedStore* pStore, const PerfSampler* sampler) noexcept : store(nullptr), startNanos(0) {
+        if (sampler && sampler->shouldSample()) {
+            start(pStore);
+        }
+    }
+
+    PerfScope(const PerfScope&) = delete;
+
+    PerfScope& operator=(const PerfScope&) = delete;
+
+    ~PerfScope() {
+        if (store) {
+            finish();
+        }
+    }
+
+private:
+    void start(ExtendedStore* pStore) noexcept;
+    void finish() noexcept;
+
+    ExtendedStore* store;
+    long long startNanos;
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include "api/Kind.h"
+
+struct ReadCacheStats {
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+    unsigned long long entries = 0;
+    unsigned long long usage = 0;
+    unsigned long long capacity = 0;
+};
+
+// Sharded LRU cache of immutable, reference-counted values. A hit hands
+// out another reference to the cached buffer, so it never copies.
+//
+// To make sure that a value read from the store before a concurrent
+// update can't be inserted after that update has invalidated the key,
+// fill() only inserts if the shard's generation hasn't changed since
+// the generation() call that preceded the read from the store.
+class ReadCache {
+public:
+
+    ReadCache(size_t capacityBytes, unsigned int numShardBits);
+
+    ReadCache(const ReadCache&) = delete;
+
+    ReadCache& operator=(const ReadCache&) = delete;
+
+    ~ReadCache();
+
+    // returns an empty pointer on a miss
+    std::shared_ptr<const char[]> lookup(const Kind& kind, std::string_view key, size_t* valLen) noexcept;
+
+    unsigned long long generation(const Kind& kind, std::string_view key) const noexcept;
+
+    void fill(const Kind& kind, std::string_view key, std::shared_ptr<const char[]> value, size_t valLen,
+        unsigned long long generation) noexcept;
+
+    void invalidate(const Kind& kind, std::string_view key) noexcept;
+
+    void invalidate(const Kind& kind) noexcept;
+
+    void clear() noexcept;
+
+    ReadCacheStats stats() const noexcept;
+
+    // Entries of Kinds with a TTL, per-entry expiry or a compaction filter can vanish
+    // without a write that invalidates them, so those Kinds are never cached. The owner
+    // decides once per Kind: rememberCacheable() keeps the first decision (and returns
+    // it), setCacheable() replaces it when the Kind's compaction filter changes.
+    std::optional<bool> isCacheable(const Kind& kind) const noexcept;
+
+    bool rememberCacheable(const Kind& kind, bool cacheable) noexcept;
+
+    void setCacheable(const Kind& kind, bool cacheable) noexcept;
+
+private:
+    struct Shard;
+    struct Policies;
+
+    Shard& shardFor(const Kind& kind, std::string_view key) const noexcept;
+
+    Shard* shards;
+    Policies* policies;
+    size_t numShards;
+    size_t capacity;
+};
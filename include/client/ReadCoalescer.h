@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include "api/Kind.h"
+
+// Single-flight coalescing of concurrent reads of the same (Kind, key).
+// The first caller becomes the leader of a flight and does the lookup,
+// all callers that join while the flight is in progress block (without
+// spinning) until the leader finish()es it and then share its result.
+class ReadCoalescer {
+public:
+    struct Flight;
+
+    explicit ReadCoalescer(unsigned int numShardBits);
+
+    ReadCoalescer(const ReadCoalescer&) = delete;
+
+    ReadCoalescer& operator=(const ReadCoalescer&) = delete;
+
+    ~ReadCoalescer();
+
+    // leader receives true if the caller must finish() the returned
+    // flight, otherwise the caller must await() it
+    Flight* join(const Kind& kind, std::string_view key, bool* leader);
+
+    void finish(Flight* flight, std::shared_ptr<const char[]> value, size_t valLen, int status) noexcept;
+
+    std::shared_ptr<const char[]> await(Flight* flight, size_t* valLen, int* status) noexcept;
+
+    // lets reads that start after a write of the key begin a new flight
+    void detach(const Kind& kind, std::string_view key) noexcept;
+
+    void detach(const Kind& kind) noexcept;
+
+    unsigned long long coalescedReads() const noexcept;
+
+private:
+    struct Shard;
+
+    Shard& shardFor(const Kind& kind, std::string_view key) const noexcept;
+
+    Shard* shards;
+    size_t numShards;
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// see api/CompactionFilterRules.h, a timestampCutoff of 0 disables the timestamp rule
+struct RetentionRules {
+    std::vector<std::string> dropKeyPrefixes;
+    std::vector<std::string> dropValuePrefixes;
+    bool timestampInValue = false;
+    size_t timestampOffset = 0;
+    unsigned int timestampWidth = 8;
+    unsigned long long timestampCutoff = 0;
+};
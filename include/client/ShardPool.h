@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "api/StatusCode.h"
+
+struct ShardCounters {
+    unsigned long long operations = 0;
+    unsigned long long failedOperations = 0;
+    // the status of the most recent failed operation
+    int lastErrorStatus = Status::Ok;
+};
+
+// One worker thread per shard for fanning an operation out to several
+// shards in parallel, and the per-shard operation counters behind the
+// shard health reports. The fanned out work of a shard is executed by
+// that shard's worker, so concurrent fan-outs queue up per shard instead
+// of competing for the same device.
+class ShardPool {
+public:
+    using Task = void (*)(void* context, size_t shard) noexcept;
+
+    explicit ShardPool(size_t numShards);
+
+    ShardPool(const ShardPool&) = delete;
+
+    ShardPool& operator=(const ShardPool&) = delete;
+
+    // waits for the queued tasks
+    ~ShardPool();
+
+    // runs task(context, shard) for every given shard and returns when all of
+    // them have completed, a single shard runs on the calling thread
+    void run(const std::vector<size_t>& shards, Task task, void* context) noexcept;
+
+    void count(size_t shard, int status) noexcept;
+
+    ShardCounters counters(size_t shard) const noexcept;
+
+private:
+    struct Impl;
+
+    Impl* impl;
+};
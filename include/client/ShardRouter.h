@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+enum class ShardRouting {
+    // keys are spread over the shards by a consistent hash ring
+    ConsistentHash,
+    // every shard holds a contiguous key range delimited by the split keys
+    Range
+};
+
+// Maps keys (and key ranges) to shards. With consistent hashing each shard
+// owns virtualNodes points on a 64-bit ring that are derived from its index
+// (not its path, so the shards can be moved), and appending a shard only
+// moves the keys that the new shard takes over. Keys are hashed with a
+// fixed FNV-1a, so the placement is the same on every platform and build.
+//
+// The placement is persistent: for an existing layout the routing, the
+// split keys, virtualNodes and the order of the shards must never change,
+// otherwise keys are looked up in shards that don't hold them.
+class ShardRouter {
+public:
+
+    // for Range routing splitKeys must hold paths.size() - 1 ascending keys, shard i
+    // holds the keys in [splitKeys[i - 1], splitKeys[i]); returns false if they don't
+    bool init(ShardRouting routing, const std::vector<std::string>& paths,
+        const std::vector<std::string>& splitKeys, unsigned int virtualNodes);
+
+    size_t shardFor(std::string_view key) const noexcept;
+
+    // the shards that may hold keys in [beginKeyInclusive, endKeyExclusive), a
+    // default-constructed (null) key view means unbounded on that side
+    std::vector<size_t> shardsFor(std::string_view beginKeyInclusive, std::string_view endKeyExclusive) const;
+
+    std::vector<size_t> allShards() const;
+
+    ShardRouting routing() const noexcept {
+        return mode;
+    }
+
+private:
+    ShardRouting mode = ShardRouting::ConsistentHash;
+    size_t numShards = 0;
+    // (point, shard) sorted by point
+    std::vector<std::pair<unsigned long long, size_t>> ring;
+    std::vector<std::string> splits;
+};
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "KVStore.h"
+#include "ShardPool.h"
+#include "ShardRouter.h"
+
+// routing, splitKeys, virtualNodes and the order of the paths decide where every key lives,
+// they must stay the same for as long as the shards exist (see ShardRouter)
+struct ShardedKVStoreOptions {
+    ShardRouting routing = ShardRouting::ConsistentHash;
+    // Range routing only: paths.size() - 1 ascending keys, shard i holds the keys in [splitKeys[i - 1], splitKeys[i])
+    std::vector<std::string> splitKeys;
+    // ConsistentHash routing only: number of points per shard on the hash ring
+    unsigned int virtualNodes = 128;
+    // used for every shard, a traceFile and a secondaryPath get the shard number appended
+    KVStoreOptions storeOptions;
+};
+
+struct ShardHealth {
+    std::string path;
+    bool open = false;
+    // operations that were routed or fanned out to the shard
+    unsigned long long operations = 0;
+    unsigned long long failedOperations = 0;
+    int lastErrorStatus = Status::Ok;
+    // all zero if the shard is closed
+    MemoryUsage memoryUsage;
+    // how long the shard took to open, the shards are opened in parallel
+    RecoveryReport recovery;
+};
+
+// A Kind that exists (under the same name) in every shard of a ShardedKVStore
+class ShardedKind {
+public:
+
+    std::string_view name() const noexcept {
+        return kindName;
+    }
+
+    const Kind& on(size_t shard) const {
+        return *kinds.at(shard);
+    }
+
+private:
+    friend class ShardedKVStore;
+
+    std::string kindName;
+    std::vector<const Kind*> kinds;
+};
+
+// Spreads the keys of every Kind over N stores on separate paths (ideally
+// separate devices), each with its own WAL, memtables and compactions.
+// Single-key operations are routed to the key's shard on the calling thread,
+// multi-key and whole-Kind operations fan out to the shards in parallel.
+//
+// There is no cross-shard atomicity or snapshot, a failure of one shard in a
+// fan-out is reported (with the first failed status) after the other shards
+// have completed their part.
+class ShardedKVStore {
+public:
+
+    explicit ShardedKVStore(const std::vector<std::string>& paths,
+        const ShardedKVStoreOptions& options = ShardedKVStoreOptions());
+
+    ShardedKVStore(const ShardedKVStore&) = delete;
+
+    ShardedKVStore& operator=(const ShardedKVStore&) = delete;
+
+    ~ShardedKVStore();
+
+    size_t shardCount() const noexcept;
+
+    size_t shardFor(std::string_view key) const noexcept;
+
+    KVStore& shard(size_t shard) const;
+
+    void put(const ShardedKind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    bool tryPut(const ShardedKind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    void remove(const ShardedKind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
+
+    bytes get(const ShardedKind& kind, std::string_view key) const;
+
+    bytes get(const ShardedKind& kind, std::string_view key, const ReadOptions& options) const;
+
+    bool contains(const ShardedKind& kind, std::string_view key) const;
+
+    bytes updateIfPresent(const ShardedKind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    void singleRemove(const ShardedKind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
+
+    bytes removeIfPresent(const ShardedKind& kind, std::string_view key, const WriteOptions& options = WriteOptions());
+
+    bool putIfAbsent(const ShardedKind& kind, std::string_view key, std::string_view value,
+        const WriteOptions& options = WriteOptions());
+
+    // the shards look up their part of the keys in parallel, the values are in the order of the keys
+    std::vector<bytes> multiGet(const ShardedKind& kind, const std::vector<std::string_view>& keys,
+        const ReadOptions& options = ReadOptions()) const;
+
+    bytes findMinKey(const ShardedKind& kind, const ReadOptions& options = ReadOptions()) const;
+
+    bytes findMaxKey(const ShardedKind& kind, const ReadOptions& options = ReadOptions()) const;
+
+    // only touches the shards that may hold keys of the range if keys are routed by range
+    void removeRange(const ShardedKind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+        const WriteOptions& options = WriteOptions());
+
+    void purgeRange(const ShardedKind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+        bool compactBoundaries = false, const WriteOptions& options = WriteOptions());
+
+    unsigned long long approximateSize(const ShardedKind& kind, std::string_view beginKeyInclusive,
+        std::string_view endKeyExclusive) const;
+
+    unsigned long long estimateNumKeys(const ShardedKind& kind) const;
+
+    // one estimate per shard, shows how evenly the keys are spread
+    std::vector<unsigned long long> estimateNumKeysPerShard(const ShardedKind& kind) const;
+
+    void compact(const ShardedKind& kind);
+
+    void compactAll();
+
+    void close();
+
+    // true if all shards are open
+    bool isOpen() const noexcept;
+
+    // for shards opened with OpenMode::Secondary, all shards catch up in parallel
+    void tryCatchUpWithPrimary();
+
+    ShardedKind getDefaultKind() const;
+
+    ShardedKind getOrCreateKind(std::string_view kindName);
+
+    ShardedKind getOrCreateKind(std::string_view kindName, const KindOptions& options);
+
+    // the Kinds that exist in every shard
+    std::vector<ShardedKind> getKinds() const;
+
+    std::vector<ShardHealth> getShardHealth() const;
+
+private:
+    using ShardOp = std::function<void(size_t shard)>;
+
+    // runs op on every given shard in parallel and throws the first failed status
+    void fanOut(const std::vector<size_t>& targets, const ShardOp& op) const;
+    ShardedKind resolve(std::string_view kindName, const std::function<const Kind&(KVStore& store)>& kindOf);
+
+    std::vector<std::string> paths;
+    std::vector<KVStore*> shards;
+    ShardRouter router;
+    ShardPool* pool;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string_view>
+#include "api/SstWriter.h"
+
+class KVStore;
+
+class SstFileWriter {
+public:
+
+    SstFileWriter(const SstFileWriter&) = delete;
+
+    SstFileWriter& operator=(const SstFileWriter&) = delete;
+
+    ~SstFileWriter();
+
+    void open(std::string_view filePath);
+
+    void put(std::string_view key, std::string_view value);
+
+    void finish();
+
+    unsigned long long fileSize() const noexcept;
+
+    unsigned long long numEntries() const noexcept;
+
+    friend class KVStore;
+
+private:
+    explicit SstFileWriter(SstWriter* pWriter) : writer(pWriter) {
+    }
+
+private:
+    SstWriter* writer;
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <string_view>
+#include "api/Kind.h"
+
+enum class TraceOp : unsigned char {
+    // the key holds the name of the Kind that the record's kind id stands for
+    DefineKind = 0,
+    Put = 1,
+    Get = 2,
+    Remove = 3,
+    SingleRemove = 4,
+    PutIfAbsent = 5,
+    UpdateIfPresent = 6,
+    RemoveIfPresent = 7,
+    SingleRemoveIfPresent = 8,
+    Contains = 9
+};
+
+// Binary trace of KVStore operations. The file starts with the 8 byte magic
+// "LRTRACE1" followed by records of
+//
+//   op (1 byte), thread (4), kind id (4), microseconds since start (8),
+//   key length (4), value size (4), key bytes
+//
+// in native (little-endian) byte order. The records of a thread are in
+// order, but the records of different threads are interleaved in chunks.
+//
+// Every thread appends to its own lock-free single-producer ring buffer
+// and a background thread drains the rings into the file. A record that
+// doesn't fit into a full ring is dropped (and counted) instead of
+// blocking the operation.
+class TraceRecorder {
+public:
+
+    // status is IOError if the trace file can't be created
+    TraceRecorder(int* status, std::string_view path);
+
+    TraceRecorder(const TraceRecorder&) = delete;
+
+    TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+    // writes out everything that has been recorded and closes the file,
+    // there must be no concurrent record() calls at this point
+    ~TraceRecorder();
+
+    void record(TraceOp op, const Kind& kind, std::string_view key, size_t valueSize) noexcept;
+
+    unsigned long long droppedRecords() const noexcept;
+
+private:
+    struct Impl;
+
+    Impl* impl;
+};
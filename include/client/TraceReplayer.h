@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string_view>
+
+struct TraceReplayReport {
+    unsigned long long operations = 0;
+    // operations that failed with a status other than NotFound or AlreadyExists
+    unsigned long long failedOperations = 0;
+    unsigned long long elapsedNanos = 0;
+    double operationsPerSecond = 0.0;
+    unsigned long long meanLatencyNanos = 0;
+    unsigned long long p50LatencyNanos = 0;
+    unsigned long long p99LatencyNanos = 0;
+    unsigned long long p999LatencyNanos = 0;
+    unsigned long long maxLatencyNanos = 0;
+};
+
+// Re-executes a trace written by TraceRecorder against a fresh store. Every
+// traced thread gets its own replay thread, so the original concurrency is
+// preserved. Values aren't traced, puts write filler values of the recorded size.
+class TraceReplayer {
+public:
+
+    // speedup 1.0 keeps the original pacing, 10.0 runs ten times as fast and 0
+    // runs as fast as possible; status is InvalidArgument if storePath already
+    // exists, IOError if the trace can't be read, Corruption if it isn't a valid
+    // trace, or the status of opening the store
+    static TraceReplayReport replay(int* status, std::string_view tracePath, std::string_view storePath,
+        double speedup) noexcept;
+};
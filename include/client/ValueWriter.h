@@ -0,0 +1,51 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "api/Kind.h"
+
+class KVStore;
+
+// Gathers the chunks of a large value in native memory and writes
+// them with a single put on commit(). Nothing is written if the
+// writer gets deleted without a commit().
+//
+// RocksDB writes a value atomically, so the whole value is held until
+// commit(): peak native memory is the full value size, plus RocksDB's own
+// copy in the write batch while commit() runs. The value is kept in blocks
+// (one of expectedSize if that is known) that are handed to the store as
+// they are, so it is never reallocated while growing nor joined for the put.
+class ValueWriter {
+public:
+
+    ValueWriter(const ValueWriter&) = delete;
+
+    ValueWriter& operator=(const ValueWriter&) = delete;
+
+    ~ValueWriter() = default;
+
+    void append(std::string_view chunk);
+
+    size_t size() const noexcept;
+
+    bool isCommitted() const noexcept;
+
+    void commit();
+
+    friend class KVStore;
+
+private:
+    explicit ValueWriter(KVStore& kvStore, const Kind& kind, std::string_view key, size_t expectedSize);
+
+private:
+    static constexpr size_t BLOCK_SIZE = 1024 * 1024;
+
+    KVStore& store;
+    const Kind& kind;
+    std::string key;
+    std::vector<std::string> blocks;
+    size_t firstBlockSize;
+    size_t total;
+    bool committed;
+};
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <memory>
 #include <string>
 
 class KVStore;
@@ -47,16 +48,28 @@ public:
 
     void swap(bytes& src) noexcept;
 
+    // total size of all result buffers in the process that are still alive (owned
+    // or shared by bytes instances, or retained by a read cache)
+    static unsigned long long liveBytes() noexcept;
+
     friend class KVStore;
 
 private:
-    explicit bytes(char* bytes, size_t length) : size_(length), data_(bytes) {
+    explicit bytes(char* bytes, size_t length);
+
+    // shares the (immutable) buffer instead of owning it, copies of such bytes share it as well
+    explicit bytes(std::shared_ptr<const char[]> shared, size_t length)
+        : size_(length), data_(shared.get()), shared_(std::move(shared)) {
     }
 
     void copy(const bytes& other);
 
+    // takes ownership of buf, the returned buffer stays accounted in liveBytes() until its last reference is gone
+    static std::shared_ptr<const char[]> share(char* buf, size_t length);
+
 private:
     size_t size_;
     const char* data_;
+    std::shared_ptr<const char[]> shared_;
 };
 
@@ -0,0 +1,51 @@
+
+#include "client/ChangeStream.h"
+#include "client/KVStore.h"
+#include <memory>
+
+ChangeStream::~ChangeStream() {
+    if (feed) {
+        delete feed;
+        feed = nullptr;
+    }
+}
+
+std::vector<ChangeSet> ChangeStream::poll(size_t maxBatches) {
+    std::vector<ChangeSet> batches;
+    while (batches.size() < maxBatches) {
+        int status = Status::Ok;
+        // owned until its records have been copied, the copying may throw
+        std::unique_ptr<ChangeBatch> batch(feed->next(&status));
+        if (status != Status::Ok) {
+            // the feed hasn't moved past the failed batch, the next poll() reports the error
+            if (batches.empty()) {
+                KVStore::throwForStatus(status);
+            }
+            break;
+        }
+        if (!batch) {
+            break;
+        }
+        ChangeSet changeSet;
+        changeSet.sequenceNumber = batch->sequenceNumber();
+        changeSet.changes.reserve(batch->size());
+        for (size_t i = 0; i < batch->size(); ++i) {
+            const ChangeRecord& record = batch->record(i);
+            Change change;
+            change.kind = record.kind;
+            change.type = record.type;
+            change.key.assign(record.key, record.keyLen);
+            if (record.value) {
+                change.value.assign(record.value, record.valLen);
+            }
+            changeSet.changes.push_back(std::move(change));
+        }
+        batch.reset();
+        batches.push_back(std::move(changeSet));
+    }
+    return batches;
+}
+
+unsigned long long ChangeStream::position() const noexcept {
+    return feed->position();
+}
@@ -0,0 +1,54 @@
+
+#include "client/Compaction.h"
+#include "client/KVStore.h"
+
+Compaction::~Compaction() {
+    if (job) {
+        if (!job->isDone()) {
+            job->cancel();
+            while (!job->await(std::chrono::milliseconds(100))) {
+            }
+        }
+        delete job;
+        job = nullptr;
+    }
+}
+
+bool Compaction::isDone() const noexcept {
+    return job->isDone();
+}
+
+bool Compaction::isCancelled() const noexcept {
+    return job->status() == Status::Aborted;
+}
+
+unsigned long long Compaction::bytesRead() const noexcept {
+    return job->bytesRead();
+}
+
+unsigned long long Compaction::bytesWritten() const noexcept {
+    return job->bytesWritten();
+}
+
+unsigned long long Compaction::filesIn() const noexcept {
+    return job->filesIn();
+}
+
+unsigned long long Compaction::filesOut() const noexcept {
+    return job->filesOut();
+}
+
+void Compaction::cancel() noexcept {
+    job->cancel();
+}
+
+bool Compaction::wait(std::chrono::milliseconds timeout) {
+    if (!job->await(timeout)) {
+        return false;
+    }
+    int status = job->status();
+    if (!(status == Status::Ok || status == Status::Aborted)) {
+        KVStore::throwForStatus(status);
+    }
+    return true;
+}
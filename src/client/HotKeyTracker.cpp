@@ -0,0 +1,242 @@
+
+#include "client/HotKeyTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace {
+    constexpr unsigned int SKETCH_DEPTH = 4;
+    constexpr unsigned int SKETCH_WIDTH_BITS = 11;
+    constexpr size_t SKETCH_WIDTH = size_t(1) << SKETCH_WIDTH_BITS;
+    // keeps prefixes and whole keys apart in the shared sketch
+    constexpr unsigned long long PREFIX_SALT = 0x5bd1e9955bd1e995ULL;
+    constexpr unsigned long long ROW_SEEDS[SKETCH_DEPTH] = {
+        0x9e3779b97f4a7c15ULL, 0xc2b2ae3d27d4eb4fULL, 0x165667b19e3779f9ULL, 0xd6e8feb86659fd93ULL
+    };
+
+    // ids are never reused, so a countdown left behind by a destroyed tracker is simply taken over
+    std::atomic<unsigned long long> nextTrackerId{ 1 };
+
+    // every thread keeps a countdown per tracker, trackers whose ids are COUNTDOWN_SLOTS
+    // apart share a slot and restart each other's countdown (a thread rarely uses that many)
+    constexpr size_t COUNTDOWN_SLOTS = 8;
+
+    struct Countdown {
+        unsigned long long tracker = 0;
+        unsigned int remaining = 0;
+    };
+
+    thread_local Countdown countdowns[COUNTDOWN_SLOTS];
+
+    unsigned long long hashOf(std::string_view bytes) noexcept {
+        return static_cast<unsigned long long>(std::hash<std::string_view>()(bytes));
+    }
+
+    size_t column(unsigned long long hash, unsigned int row) noexcept {
+        unsigned long long x = (hash ^ ROW_SEEDS[row]) * 0xff51afd7ed558ccdULL;
+        return static_cast<size_t>(x >> (64 - SKETCH_WIDTH_BITS));
+    }
+
+    bool hotter(const HotKey& a, const HotKey& b) noexcept {
+        return a.estimatedCount > b.estimatedCount;
+    }
+}
+
+struct Stream {
+    std::uint32_t sketch[SKETCH_DEPTH][SKETCH_WIDTH] = {};
+    std::vector<HotKey> keys;
+    std::vector<HotKey> prefixes;
+    // samples since the last aging step
+    unsigned long long window = 0;
+    // samples since the last reset
+    unsigned long long total = 0;
+
+    void add(std::string_view key, unsigned int topK, unsigned int prefixLength) {
+        offer(keys, key, increment(hashOf(key)), topK);
+        if (prefixLength > 0 && key.size() >= prefixLength) {
+            std::string_view prefix = key.substr(0, prefixLength);
+            offer(prefixes, prefix, increment(hashOf(prefix) ^ PREFIX_SALT), topK);
+        }
+        ++total;
+        if (++window == HotKeyTracker::AGING_WINDOW) {
+            age();
+        }
+    }
+
+    // conservative update: only the minimal counters are incremented
+    std::uint32_t increment(unsigned long long hash) noexcept {
+        size_t cols[SKETCH_DEPTH];
+        std::uint32_t min = UINT32_MAX;
+        for (unsigned int row = 0; row < SKETCH_DEPTH; ++row) {
+            cols[row] = column(hash, row);
+            min = std::min(min, sketch[row][cols[row]]);
+        }
+        if (min == UINT32_MAX) {
+            return min;
+        }
+        for (unsigned int row = 0; row < SKETCH_DEPTH; ++row) {
+            if (sketch[row][cols[row]] == min) {
+                ++sketch[row][cols[row]];
+            }
+        }
+        return min + 1;
+    }
+
+    static void offer(std::vector<HotKey>& top, std::string_view key, std::uint32_t estimate, unsigned int topK) {
+        size_t coldest = 0;
+        for (size_t i = 0; i < top.size(); ++i) {
+            if (top[i].key == key) {
+                top[i].estimatedCount = estimate;
+                return;
+            }
+            if (top[i].estimatedCount < top[coldest].estimatedCount) {
+                coldest = i;
+            }
+        }
+        if (top.size() < topK) {
+            top.push_back(HotKey{ std::string(key), estimate });
+        }
+        else if (estimate > top[coldest].estimatedCount) {
+            top[coldest].key.assign(key.data(), key.size());
+            top[coldest].estimatedCount = estimate;
+        }
+    }
+
+    void age() noexcept {
+        for (auto& row : sketch) {
+            for (std::uint32_t& counter : row) {
+                counter >>= 1;
+            }
+        }
+        for (HotKey& hot : keys) {
+            hot.estimatedCount >>= 1;
+        }
+        for (HotKey& hot : prefixes) {
+            hot.estimatedCount >>= 1;
+        }
+        window = 0;
+    }
+
+    void clear() noexcept {
+        for (auto& row : sketch) {
+            std::fill(std::begin(row), std::end(row), 0);
+        }
+        keys.clear();
+        prefixes.clear();
+        window = 0;
+        total = 0;
+    }
+};
+
+struct HotKeyTracker::Slot {
+    // the Kind's address identifies the Kind (Kinds live as long as their store)
+    std::atomic<const Kind*> kind{ nullptr };
+    std::mutex mutex;
+    // the streams are allocated on the first sample of the Kind
+    std::string name;
+    std::unique_ptr<Stream> reads;
+    std::unique_ptr<Stream> writes;
+};
+
+HotKeyTracker::HotKeyTracker(unsigned int sampleInterval, unsigned int topK, unsigned int prefixLength)
+    : slots(nullptr), id(nextTrackerId.fetch_add(1, std::memory_order_relaxed)), interval(sampleInterval > 0 ? sampleInterval : 1),
+    topK(static_cast<unsigned int>(std::clamp<size_t>(topK, 1, MAX_TOP_K))), prefixLength(prefixLength) {
+    slots = new Slot[MAX_KINDS];
+}
+
+HotKeyTracker::~HotKeyTracker() {
+    delete[] slots;
+    slots = nullptr;
+}
+
+// open addressing on the Kind's address, a slot is never released again
+HotKeyTracker::Slot* HotKeyTracker::slotFor(const Kind& kind) noexcept {
+    size_t start = (reinterpret_cast<std::uintptr_t>(&kind) >> 4) % MAX_KINDS;
+    for (size_t i = 0; i < MAX_KINDS; ++i) {
+        Slot& slot = slots[(start + i) % MAX_KINDS];
+        const Kind* owner = slot.kind.load(std::memory_order_acquire);
+        if (owner == nullptr) {
+            if (slot.kind.compare_exchange_strong(owner, &kind, std::memory_order_acq_rel)) {
+                return &slot;
+            }
+        }
+        if (owner == &kind) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void HotKeyTracker::record(const Kind& kind, std::string_view key, bool write) noexcept {
+    Countdown& countdown = countdowns[id % COUNTDOWN_SLOTS];
+    if (countdown.tracker != id) {
+        countdown.tracker = id;
+        countdown.remaining = 0;
+    }
+    if (countdown.remaining != 0) {
+        --countdown.remaining;
+        return;
+    }
+    countdown.remaining = interval - 1;
+    Slot* slot = slotFor(kind);
+    if (!slot) {
+        return;
+    }
+    if (key.size() > MAX_KEY_LENGTH) {
+        key = key.substr(0, MAX_KEY_LENGTH);
+    }
+    try {
+        std::lock_guard<std::mutex> lock(slot->mutex);
+        if (!slot->reads) {
+            slot->name = kind.name();
+            slot->reads = std::make_unique<Stream>();
+            slot->writes = std::make_unique<Stream>();
+        }
+        Stream& stream = write ? *slot->writes : *slot->reads;
+        stream.add(key, topK, prefixLength);
+    }
+    catch (...) {
+        // losing a sample is harmless
+    }
+}
+
+std::vector<HotKeyStats> HotKeyTracker::snapshot() const {
+    std::vector<HotKeyStats> result;
+    for (size_t i = 0; i < MAX_KINDS; ++i) {
+        Slot& slot = slots[i];
+        std::lock_guard<std::mutex> lock(slot.mutex);
+        if (!slot.reads || (slot.reads->total == 0 && slot.writes->total == 0)) {
+            continue;
+        }
+        HotKeyStats stats;
+        stats.kindName = slot.name;
+        stats.sampledReads = slot.reads->total;
+        stats.sampledWrites = slot.writes->total;
+        stats.readKeys = slot.reads->keys;
+        stats.writeKeys = slot.writes->keys;
+        stats.readPrefixes = slot.reads->prefixes;
+        stats.writePrefixes = slot.writes->prefixes;
+        std::vector<HotKey>* lists[] = { &stats.readKeys, &stats.writeKeys, &stats.readPrefixes, &stats.writePrefixes };
+        for (std::vector<HotKey>* top : lists) {
+            for (HotKey& hot : *top) {
+                hot.estimatedCount *= interval;
+            }
+            std::sort(top->begin(), top->end(), hotter);
+        }
+        result.push_back(std::move(stats));
+    }
+    return result;
+}
+
+void HotKeyTracker::reset() noexcept {
+    for (size_t i = 0; i < MAX_KINDS; ++i) {
+        std::lock_guard<std::mutex> lock(slots[i].mutex);
+        if (slots[i].reads) {
+            slots[i].reads->clear();
+            slots[i].writes->clear();
+        }
+    }
+}
@@ -2,28 +2,125 @@
 #include "api/librocks.h"
 #include "client/KVStore.h"
 #include "../RocksDbException.h"
+#include <algorithm>
+#include <cstring> // std::memcpy
 
 using namespace System;
 
-KVStore::KVStore(std::string_view path) {
+KVStore::KVStore(std::string_view path) : KVStore(path, KVStoreOptions()) {
+}
+
+KVStore::KVStore(Store* pStore) : KVStore(pStore, KVStoreOptions()) {
+}
+
+KVStore::KVStore(std::string_view path, const KVStoreOptions& options)
+    : store(nullptr), extended(nullptr), cache(nullptr), coalescer(nullptr), sampler(nullptr), tracer(nullptr),
+    hotKeys(nullptr) {
     int status = Status::Ok;
-    store = openStore(&status, std::string(path).c_str());
+    switch (options.openMode) {
+    case OpenMode::ReadOnly:
+        store = openStoreReadOnly(&status, std::string(path).c_str(), &options.storeOptions);
+        break;
+    case OpenMode::Secondary:
+        store = openStoreSecondary(&status, std::string(path).c_str(), options.secondaryPath.c_str(),
+            &options.storeOptions);
+        break;
+    default:
+        store = openStoreWithOptions(&status, std::string(path).c_str(), &options.storeOptions);
+        break;
+    }
     if (status != Status::Ok) {
         throwForStatus(status);
     }
+    init(options);
 }
 
-KVStore::KVStore(Store* pStore) : store(pStore) {
+KVStore::KVStore(Store* pStore, const KVStoreOptions& options) : store(pStore), extended(nullptr), cache(nullptr),
+    coalescer(nullptr), sampler(nullptr), tracer(nullptr), hotKeys(nullptr) {
+    init(options);
 }
 
 KVStore::~KVStore() {
+    release();
+}
+
+KVStore* KVStore::openReadOnly(std::string_view path, const KVStoreOptions& options) {
+    KVStoreOptions readOnly = options;
+    readOnly.openMode = OpenMode::ReadOnly;
+    return new KVStore(path, readOnly);
+}
+
+KVStore* KVStore::openSecondary(std::string_view path, std::string_view secondaryPath,
+    const KVStoreOptions& options) {
+    KVStoreOptions secondary = options;
+    secondary.openMode = OpenMode::Secondary;
+    secondary.secondaryPath = std::string(secondaryPath);
+    return new KVStore(path, secondary);
+}
+
+void KVStore::init(const KVStoreOptions& options) {
+    int status = Status::Ok;
+    extended = getExtendedStore(&status, store);
+    if (status != Status::Ok) {
+        // the destructor won't run for a constructor that throws
+        release();
+        throwForStatus(status);
+    }
+    if (options.readCacheCapacity > 0) {
+        cache = new ReadCache(options.readCacheCapacity, options.readCacheShardBits);
+    }
+    if (options.coalesceReads) {
+        coalescer = new ReadCoalescer(options.readCacheShardBits);
+    }
+    if (options.perfSampleInterval > 0) {
+        sampler = new PerfSampler(options.perfSampleInterval);
+    }
+    if (options.hotKeySampleInterval > 0) {
+        hotKeys = new HotKeyTracker(options.hotKeySampleInterval, options.hotKeyTopK, options.hotKeyPrefixLength);
+    }
+    if (!options.traceFile.empty()) {
+        tracer = new TraceRecorder(&status, options.traceFile);
+        if (status != Status::Ok) {
+            // the destructor won't run for a constructor that throws
+            release();
+            throwForStatus(status);
+        }
+    }
+}
+
+void KVStore::release() noexcept {
+    if (hotKeys) {
+        delete hotKeys;
+        hotKeys = nullptr;
+    }
+    if (tracer) {
+        delete tracer;
+        tracer = nullptr;
+    }
+    if (sampler) {
+        delete sampler;
+        sampler = nullptr;
+    }
+    if (coalescer) {
+        delete coalescer;
+        coalescer = nullptr;
+    }
+    if (cache) {
+        delete cache;
+        cache = nullptr;
+    }
     if (store) {
+        // extended belongs to the store
+        extended = nullptr;
         delete store;
         store = nullptr;
     }
 }
 
 void KVStore::close() {
+    if (cache) {
+        cache->clear();
+    }
     if (store) {
         store->close();
     }
@@ -33,12 +130,31 @@ bool KVStore::isOpen() const noexcept {
     return store->isOpen();
 }
 
+bool KVStore::isReadOnly() const noexcept {
+    return extended->isReadOnly();
+}
+
+void KVStore::tryCatchUpWithPrimary() {
+    int status = Status::Ok;
+    extended->tryCatchUpWithPrimary(&status);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    if (cache) {
+        cache->clear();
+    }
+}
+
 const Kind& KVStore::getDefaultKind() const {
     int status = Status::Ok;
     const Kind& k = getKindManager().getDefaultKind(&status);
     if (status != Status::Ok) {
         throwForStatus(status);
     }
+    if (cache) {
+        // decided once per Kind, outside of the read path
+        isCacheable(k);
+    }
     return k;
 }
 
@@ -49,28 +165,57 @@ const Kind& KVStore::getOrCreateKind(std::string_view kindName) {
     if (status != Status::Ok) {
         throwForStatus(status);
     }
+    if (cache) {
+        isCacheable(k);
+    }
     return k;
 }
 
+const Kind& KVStore::getOrCreateKind(std::string_view kindName, const KindOptions& options) {
+    int status = Status::Ok;
+    const Kind& k = extended->getOrCreateKind(&status, std::string(kindName).c_str(), options);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    if (cache) {
+        isCacheable(k);
+    }
+    return k;
+}
+
+KindOptions KVStore::getKindOptions(const Kind& kind) const {
+    int status = Status::Ok;
+    KindOptions options = extended->getKindOptions(&status, kind);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return options;
+}
+
 static bool comparator(const std::reference_wrapper<const Kind>& a, const std::reference_wrapper<const Kind>& b) noexcept {
     return a.get() < b.get();
 }
 
 const KindSet KVStore::getKinds() const {
     int status = Status::Ok;
-    size_t resultLen = 0;
-    const Kind** ppK = getKindManager().getKinds(&status, &resultLen);
-    KindSet kinds(&comparator);
-    if (status == Status::Ok) {
-        for (size_t i = 0; i < resultLen; ++i) {
-            const Kind& kind = dynamic_cast<const Kind&>(*ppK[i]);
-            kinds.insert(std::cref(kind));
-        }
-        delete[] ppK;
+    // enough for almost every store, only more Kinds than that need a heap buffer
+    const Kind* local[64];
+    const Kind** found = local;
+    size_t count = extended->getKinds(&status, local, std::size(local));
+    std::vector<const Kind*> buffer;
+    // Kinds may have been created in between, retry until they fit
+    while (status == Status::Ok && count > (found == local ? std::size(local) : buffer.size())) {
+        buffer.resize(count + 16);
+        found = buffer.data();
+        count = extended->getKinds(&status, found, buffer.size());
     }
-    else {
+    if (status != Status::Ok) {
         throwForStatus(status);
     }
+    KindSet kinds(&comparator);
+    for (size_t i = 0; i < count; ++i) {
+        kinds.insert(std::cref(*found[i]));
+    }
     return kinds;
 }
 
@@ -83,25 +228,125 @@ KindManager& KVStore::getKindManager() const {
     return mgr;
 }
 
-void KVStore::put(const Kind& kind, std::string_view key, std::string_view value) {
+void KVStore::put(const Kind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Put, kind, key, value.size());
     int status = Status::Ok;
-    store->put(&status, kind, key.data(), key.size(), value.data(), value.size());
+    extended->put(&status, kind, options, key.data(), key.size(), value.data(), value.size());
     if (status != Status::Ok) {
         throwForStatus(status);
     }
+    invalidate(kind, key);
 }
 
-void KVStore::remove(const Kind& kind, std::string_view key) {
+bool KVStore::tryPut(const Kind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Put, kind, key, value.size());
+    WriteOptions noSlowdown = options;
+    noSlowdown.noSlowdown = true;
     int status = Status::Ok;
-    store->remove(&status, kind, key.data(), key.size());
+    extended->put(&status, kind, noSlowdown, key.data(), key.size(), value.data(), value.size());
+    if (status == Status::Busy) {
+        return false;
+    }
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    invalidate(kind, key);
+    return true;
+}
+
+void KVStore::putParts(const Kind& kind, std::string_view key, const std::vector<std::string_view>& parts,
+    const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    std::vector<const char*> partPtrs;
+    std::vector<size_t> partLens;
+    partPtrs.reserve(parts.size());
+    partLens.reserve(parts.size());
+    size_t valueSize = 0;
+    for (std::string_view part : parts) {
+        partPtrs.push_back(part.data());
+        partLens.push_back(part.size());
+        valueSize += part.size();
+    }
+    observe(TraceOp::Put, kind, key, valueSize);
+    int status = Status::Ok;
+    extended->putParts(&status, kind, options, key.data(), key.size(), partPtrs.data(), partLens.data(), parts.size());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    invalidate(kind, key);
+}
+
+void KVStore::putWithExpiry(const Kind& kind, std::string_view key, std::string_view value,
+    std::chrono::system_clock::time_point expiresAt, const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Put, kind, key, value.size());
+    auto sinceEpoch = std::chrono::duration_cast<std::chrono::milliseconds>(expiresAt.time_since_epoch());
+    unsigned long long expiresAtMillis = sinceEpoch.count() > 0 ? sinceEpoch.count() : 0;
+    int status = Status::Ok;
+    extended->putWithExpiry(&status, kind, options, key.data(), key.size(), value.data(), value.size(), expiresAtMillis);
     if (status != Status::Ok) {
         throwForStatus(status);
     }
+    invalidate(kind, key);
+}
+
+void KVStore::remove(const Kind& kind, std::string_view key, const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Remove, kind, key, 0);
+    int status = Status::Ok;
+    extended->remove(&status, kind, options, key.data(), key.size());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    invalidate(kind, key);
 }
 
 bytes KVStore::get(const Kind& kind, std::string_view key) const {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Get, kind, key, 0);
+    if (cache) {
+        size_t cachedLen = 0;
+        std::shared_ptr<const char[]> cached = cache->lookup(kind, key, &cachedLen);
+        if (cached) {
+            return bytes(std::move(cached), cachedLen);
+        }
+    }
     int status = Status::Ok;
     size_t resultLen = 0;
+    if (coalescer) {
+        bool leader = false;
+        ReadCoalescer::Flight* flight = coalescer->join(kind, key, &leader);
+        std::shared_ptr<const char[]> shared;
+        if (leader) {
+            try {
+                shared = loadShared(kind, key, ReadOptions(), &resultLen, &status);
+            }
+            catch (...) {
+                // the followers must never be left waiting
+                coalescer->finish(flight, nullptr, 0, Status::Unknown);
+                throw;
+            }
+            coalescer->finish(flight, shared, resultLen, status);
+        }
+        else {
+            shared = coalescer->await(flight, &resultLen, &status);
+        }
+        if (!(status == Status::Ok || status == Status::NotFound)) {
+            throwForStatus(status);
+        }
+        return shared ? bytes(std::move(shared), resultLen) : bytes(nullptr, 0);
+    }
+    if (cache) {
+        std::shared_ptr<const char[]> shared = loadShared(kind, key, ReadOptions(), &resultLen, &status);
+        if (!(status == Status::Ok || status == Status::NotFound)) {
+            throwForStatus(status);
+        }
+        return shared ? bytes(std::move(shared), resultLen) : bytes(nullptr, 0);
+    }
     char* val = store->get(&status, kind, &resultLen, key.data(), key.size());
     if (!(status == Status::Ok || status == Status::NotFound)) {
         throwForStatus(status);
@@ -109,48 +354,253 @@ bytes KVStore::get(const Kind& kind, std::string_view key) const {
     return bytes(val, resultLen);
 }
 
-bytes KVStore::updateIfPresent(const Kind& kind, std::string_view key, std::string_view value) {
+// reads the value into a shareable buffer and fills the read cache (if
+// enabled), errors are reported through status and never thrown
+std::shared_ptr<const char[]> KVStore::loadShared(const Kind& kind, std::string_view key,
+    const ReadOptions& options, size_t* resultLen, int* status) const {
+    // must be taken before the read from the store
+    unsigned long long generation = cache ? cache->generation(kind, key) : 0;
+    char* val = extended->get(status, kind, options, nullptr, resultLen, key.data(), key.size());
+    if (!val) {
+        return nullptr;
+    }
+    std::shared_ptr<const char[]> shared = bytes::share(val, *resultLen);
+    if (cache && options.fillCache && *status == Status::Ok && isCacheable(kind)) {
+        cache->fill(kind, key, shared, *resultLen, generation);
+    }
+    return shared;
+}
+
+bytes KVStore::get(const Kind& kind, std::string_view key, const Snapshot& snapshot) const {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Get, kind, key, 0);
+    int status = Status::Ok;
+    size_t resultLen = 0;
+    char* val = extended->get(&status, kind, ReadOptions(), &snapshot, &resultLen, key.data(), key.size());
+    if (!(status == Status::Ok || status == Status::NotFound)) {
+        throwForStatus(status);
+    }
+    return bytes(val, resultLen);
+}
+
+bytes KVStore::get(const Kind& kind, std::string_view key, const ReadOptions& options,
+    const Snapshot* snapshot) const {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Get, kind, key, 0);
+    if (snapshot) {
+        // the read cache only holds the latest values
+        int status = Status::Ok;
+        size_t resultLen = 0;
+        char* val = extended->get(&status, kind, options, snapshot, &resultLen, key.data(), key.size());
+        if (!(status == Status::Ok || status == Status::NotFound)) {
+            throwForStatus(status);
+        }
+        return bytes(val, resultLen);
+    }
+    if (cache) {
+        size_t cachedLen = 0;
+        std::shared_ptr<const char[]> cached = cache->lookup(kind, key, &cachedLen);
+        if (cached) {
+            return bytes(std::move(cached), cachedLen);
+        }
+    }
+    // not coalesced, every caller's deadline and cache policy must be honored
+    int status = Status::Ok;
+    size_t resultLen = 0;
+    std::shared_ptr<const char[]> shared = loadShared(kind, key, options, &resultLen, &status);
+    if (!(status == Status::Ok || status == Status::NotFound)) {
+        throwForStatus(status);
+    }
+    return shared ? bytes(std::move(shared), resultLen) : bytes(nullptr, 0);
+}
+
+// the first read goes to a small stack buffer and reports the value's size, so no more than the
+// value holds past offset is ever allocated (a large length on a small or missing value is free)
+bytes KVStore::get(const Kind& kind, std::string_view key, size_t offset, size_t length,
+    const ReadOptions& options) const {
+    constexpr size_t SMALL_READ_SIZE = 256;
+    char small[SMALL_READ_SIZE];
+    size_t valueSize = 0;
+    std::optional<size_t> copied = read(kind, key, offset, small, std::min(length, SMALL_READ_SIZE), &valueSize,
+        nullptr, options);
+    if (!copied) {
+        return bytes(nullptr, 0);
+    }
+    auto available = [offset, length](size_t size) noexcept {
+        return size > offset ? std::min(length, size - offset) : 0;
+    };
+    size_t wanted = available(valueSize);
+    // the value may have been overwritten in between, so a grown value is read again
+    while (wanted > *copied) {
+        std::unique_ptr<char[]> buf(new char[wanted]);
+        copied = read(kind, key, offset, buf.get(), wanted, &valueSize, nullptr, options);
+        if (!copied) {
+            return bytes(nullptr, 0);
+        }
+        size_t now = available(valueSize);
+        if (now <= wanted) {
+            if (*copied > 0) {
+                return bytes(buf.release(), *copied);
+            }
+            break;
+        }
+        wanted = now;
+    }
+    if (*copied == 0) {
+        // offset at or past the end, unlike a missing key that's an empty (but non-null) result
+        return bytes(bytes::share(new char[1], 0), 0);
+    }
+    char* buf = new char[*copied];
+    std::memcpy(buf, small, *copied);
+    return bytes(buf, *copied);
+}
+
+std::optional<size_t> KVStore::read(const Kind& kind, std::string_view key, size_t offset, char* dest,
+    size_t destLen, size_t* valueSize, const Snapshot* snapshot, const ReadOptions& options) const {
+    PerfScope perf(extended, sampler);
+    int status = Status::Ok;
+    size_t totalLen = 0;
+    size_t copied = extended->readRange(&status, kind, options, snapshot, key.data(), key.size(), offset, dest,
+        destLen, &totalLen);
+    if (status == Status::NotFound) {
+        return std::nullopt;
+    }
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    if (valueSize) {
+        *valueSize = totalLen;
+    }
+    return copied;
+}
+
+ValueWriter* KVStore::createValueWriter(const Kind& kind, std::string_view key, size_t expectedSize) {
+    return new ValueWriter(*this, kind, key, expectedSize);
+}
+
+bool KVStore::contains(const Kind& kind, std::string_view key) const {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::Contains, kind, key, 0);
+    int status = Status::Ok;
+    bool found = extended->contains(&status, kind, key.data(), key.size());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return found;
+}
+
+std::optional<size_t> KVStore::valueSize(const Kind& kind, std::string_view key) const {
+    PerfScope perf(extended, sampler);
+    int status = Status::Ok;
+    size_t size = extended->valueSize(&status, kind, key.data(), key.size());
+    if (status == Status::NotFound) {
+        return std::nullopt;
+    }
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return size;
+}
+
+std::vector<bytes> KVStore::multiGet(const Kind& kind, const std::vector<std::string_view>& keys,
+    const Snapshot* snapshot, const ReadOptions& options) const {
+    PerfScope perf(extended, sampler);
+    std::vector<bytes> values;
+    if (keys.empty()) {
+        return values;
+    }
+    for (std::string_view key : keys) {
+        observe(TraceOp::Get, kind, key, 0);
+    }
+    const size_t numKeys = keys.size();
+    std::vector<const char*> keyPtrs(numKeys);
+    std::vector<size_t> keyLens(numKeys);
+    for (size_t i = 0; i < numKeys; ++i) {
+        keyPtrs[i] = keys[i].data();
+        keyLens[i] = keys[i].size();
+    }
+    std::vector<size_t> resultLens(numKeys, 0);
+    std::vector<int> statuses(numKeys, Status::Ok);
+    int status = Status::Ok;
+    char** vals = extended->multiGet(&status, kind, options, snapshot, numKeys, keyPtrs.data(), keyLens.data(),
+        resultLens.data(), statuses.data());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    // take ownership of all elements first so that nothing leaks if a per-key status throws
+    values.reserve(numKeys);
+    for (size_t i = 0; i < numKeys; ++i) {
+        values.push_back(bytes(vals[i], resultLens[i]));
+    }
+    delete[] vals;
+    for (size_t i = 0; i < numKeys; ++i) {
+        if (!(statuses[i] == Status::Ok || statuses[i] == Status::NotFound)) {
+            throwForStatus(statuses[i]);
+        }
+    }
+    return values;
+}
+
+bytes KVStore::updateIfPresent(const Kind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::UpdateIfPresent, kind, key, value.size());
     int status = Status::Ok;
     size_t resultLen = 0;
-    char* oldVal = store->updateIfPresent(&status, kind, &resultLen, key.data(), key.size(), value.data(), value.size());
+    char* oldVal = extended->updateIfPresent(&status, kind, options, &resultLen, key.data(), key.size(), value.data(),
+        value.size());
     if (!(status == Status::Ok || status == Status::NotFound)) {
         throwForStatus(status);
     }
+    invalidate(kind, key);
     return bytes(oldVal, resultLen);
 }
 
-void KVStore::singleRemove(const Kind& kind, std::string_view key) {
+void KVStore::singleRemove(const Kind& kind, std::string_view key, const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::SingleRemove, kind, key, 0);
     int status = Status::Ok;
-    store->singleRemove(&status, kind, key.data(), key.size());
+    extended->singleRemove(&status, kind, options, key.data(), key.size());
     if (status != Status::Ok) {
         throwForStatus(status);
     }
+    invalidate(kind, key);
 }
 
-bytes KVStore::singleRemoveIfPresent(const Kind& kind, std::string_view key) {
+bytes KVStore::singleRemoveIfPresent(const Kind& kind, std::string_view key, const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::SingleRemoveIfPresent, kind, key, 0);
     int status = Status::Ok;
     size_t resultLen = 0;
-    char* removed = store->singleRemoveIfPresent(&status, kind, &resultLen, key.data(), key.size());
+    char* removed = extended->singleRemoveIfPresent(&status, kind, options, &resultLen, key.data(), key.size());
     if (!(status == Status::Ok || status == Status::NotFound)) {
         throwForStatus(status);
     }
+    invalidate(kind, key);
     return bytes(removed, resultLen);
 }
 
-bytes KVStore::removeIfPresent(const Kind& kind, std::string_view key) {
+bytes KVStore::removeIfPresent(const Kind& kind, std::string_view key, const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::RemoveIfPresent, kind, key, 0);
     int status = Status::Ok;
     size_t resultLen = 0;
-    char* removed = store->removeIfPresent(&status, kind, &resultLen, key.data(), key.size());
+    char* removed = extended->removeIfPresent(&status, kind, options, &resultLen, key.data(), key.size());
     if (!(status == Status::Ok || status == Status::NotFound)) {
         throwForStatus(status);
     }
+    invalidate(kind, key);
     return bytes(removed, resultLen);
 }
 
-bool KVStore::putIfAbsent(const Kind& kind, std::string_view key, std::string_view value) {
+bool KVStore::putIfAbsent(const Kind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    PerfScope perf(extended, sampler);
+    observe(TraceOp::PutIfAbsent, kind, key, value.size());
     int status = Status::Ok;
-    store->putIfAbsent(&status, kind, key.data(), key.size(), value.data(), value.size());
+    extended->putIfAbsent(&status, kind, options, key.data(), key.size(), value.data(), value.size());
     if (status == Status::Ok) {
+        invalidate(kind, key);
         return true;
     }
     else if (status == Status::AlreadyExists) {
@@ -159,26 +609,103 @@ bool KVStore::putIfAbsent(const Kind& kind, std::string_view key, std::string_vi
     return throwForStatus(status);
 }
 
-bytes KVStore::findMinKey(const Kind& kind) const {
+bytes KVStore::findMinKey(const Kind& kind, const ReadOptions& options) const {
+    PerfScope perf(extended, sampler);
     int status = Status::Ok;
     size_t resultLen = 0;
-    char* minKey = store->findMinKey(&status, kind, &resultLen);
+    char* minKey = extended->findMinKey(&status, kind, options, &resultLen);
     if (status != Status::Ok) {
         throwForStatus(status);
     }
     return bytes(minKey, resultLen);
 }
 
-bytes KVStore::findMaxKey(const Kind& kind) const {
+bytes KVStore::findMaxKey(const Kind& kind, const ReadOptions& options) const {
+    PerfScope perf(extended, sampler);
     int status = Status::Ok;
     size_t resultLen = 0;
-    char* maxKey = store->findMaxKey(&status, kind, &resultLen);
+    char* maxKey = extended->findMaxKey(&status, kind, options, &resultLen);
     if (status != Status::Ok) {
         throwForStatus(status);
     }
     return bytes(maxKey, resultLen);
 }
 
+void KVStore::removeRange(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+    const WriteOptions& options) {
+    int status = Status::Ok;
+    extended->removeRange(&status, kind, options, beginKeyInclusive.data(), beginKeyInclusive.size(),
+        endKeyExclusive.data(), endKeyExclusive.size());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    invalidate(kind);
+}
+
+void KVStore::purgeRange(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+    bool compactBoundaries, const WriteOptions& options) {
+    int status = Status::Ok;
+    extended->purgeRange(&status, kind, options, beginKeyInclusive.data(), beginKeyInclusive.size(),
+        endKeyExclusive.data(), endKeyExclusive.size(), compactBoundaries);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    invalidate(kind);
+}
+
+unsigned long long KVStore::approximateSize(const Kind& kind, std::string_view beginKeyInclusive,
+    std::string_view endKeyExclusive) const {
+    unsigned long long onDiskBytes = 0;
+    unsigned long long memtableBytes = 0;
+    approximateSize(kind, beginKeyInclusive, endKeyExclusive, onDiskBytes, memtableBytes);
+    return onDiskBytes + memtableBytes;
+}
+
+void KVStore::approximateSize(const Kind& kind, std::string_view beginKeyInclusive, std::string_view endKeyExclusive,
+    unsigned long long& onDiskBytes, unsigned long long& memtableBytes) const {
+    int status = Status::Ok;
+    extended->approximateSize(&status, kind, beginKeyInclusive.data(), beginKeyInclusive.size(), endKeyExclusive.data(),
+        endKeyExclusive.size(), &onDiskBytes, &memtableBytes);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+}
+
+unsigned long long KVStore::estimateNumKeys(const Kind& kind) const {
+    int status = Status::Ok;
+    unsigned long long numKeys = extended->estimateNumKeys(&status, kind);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return numKeys;
+}
+
+BlobStats KVStore::getBlobStats(const Kind& kind) const {
+    int status = Status::Ok;
+    BlobStats stats = extended->getBlobStats(&status, kind);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return stats;
+}
+
+MemoryUsage KVStore::memoryUsage() const {
+    int status = Status::Ok;
+    MemoryUsage usage = extended->memoryUsage(&status);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    if (cache) {
+        usage.readCache = cache->stats().usage;
+    }
+    usage.liveResultBuffers = bytes::liveBytes();
+    return usage;
+}
+
+RecoveryReport KVStore::recoveryReport() const noexcept {
+    return extended->recoveryReport();
+}
+
 void KVStore::compact(const Kind& kind) {
     int status = Status::Ok;
     store->compact(&status, kind);
@@ -195,6 +722,243 @@ void KVStore::compactAll() {
     }
 }
 
+void KVStore::setRateLimits(const RateLimits& limits) {
+    int status = Status::Ok;
+    extended->setRateLimits(&status, limits);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+}
+
+RateLimits KVStore::getRateLimits() const {
+    int status = Status::Ok;
+    RateLimits limits = extended->getRateLimits(&status);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return limits;
+}
+
+void KVStore::setCompactionFilter(const Kind& kind, const RetentionRules& rules) {
+    if (!(rules.timestampWidth == 4 || rules.timestampWidth == 8)) {
+        throwForStatus(Status::InvalidArgument);
+    }
+    std::vector<const char*> keyPrefixes;
+    std::vector<size_t> keyPrefixLens;
+    for (const std::string& prefix : rules.dropKeyPrefixes) {
+        keyPrefixes.push_back(prefix.data());
+        keyPrefixLens.push_back(prefix.size());
+    }
+    std::vector<const char*> valuePrefixes;
+    std::vector<size_t> valuePrefixLens;
+    for (const std::string& prefix : rules.dropValuePrefixes) {
+        valuePrefixes.push_back(prefix.data());
+        valuePrefixLens.push_back(prefix.size());
+    }
+    CompactionFilterRules nativeRules;
+    nativeRules.dropKeyPrefixes = keyPrefixes.data();
+    nativeRules.dropKeyPrefixLens = keyPrefixLens.data();
+    nativeRules.numDropKeyPrefixes = keyPrefixes.size();
+    nativeRules.dropValuePrefixes = valuePrefixes.data();
+    nativeRules.dropValuePrefixLens = valuePrefixLens.data();
+    nativeRules.numDropValuePrefixes = valuePrefixes.size();
+    nativeRules.timestampInValue = rules.timestampInValue;
+    nativeRules.timestampOffset = rules.timestampOffset;
+    nativeRules.timestampWidth = rules.timestampWidth;
+    nativeRules.timestampCutoff = rules.timestampCutoff;
+    int status = Status::Ok;
+    extended->setCompactionFilter(&status, kind, nativeRules);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    // from now on entries of this Kind may vanish with any compaction
+    if (cache) {
+        cache->setCacheable(kind, false);
+    }
+    invalidate(kind);
+}
+
+void KVStore::clearCompactionFilter(const Kind& kind) {
+    int status = Status::Ok;
+    extended->clearCompactionFilter(&status, kind);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    if (cache) {
+        cache->setCacheable(kind, allowsCaching(kind));
+    }
+}
+
+bool KVStore::takePerfSample(PerfSample* sample) noexcept {
+    return PerfSampler::take(sample);
+}
+
+std::vector<HotKeyStats> KVStore::getHotKeys() const {
+    return hotKeys ? hotKeys->snapshot() : std::vector<HotKeyStats>();
+}
+
+void KVStore::resetHotKeys() noexcept {
+    if (hotKeys) {
+        hotKeys->reset();
+    }
+}
+
+unsigned long long KVStore::getDroppedTraceRecords() const noexcept {
+    return tracer ? tracer->droppedRecords() : 0;
+}
+
+TraceReplayReport KVStore::replayTrace(std::string_view tracePath, std::string_view storePath, double speedup) {
+    int status = Status::Ok;
+    TraceReplayReport report = TraceReplayer::replay(&status, tracePath, storePath, speedup);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return report;
+}
+
+ReadCacheStats KVStore::getReadCacheStats() const noexcept {
+    return cache ? cache->stats() : ReadCacheStats();
+}
+
+unsigned long long KVStore::getCoalescedReadCount() const noexcept {
+    return coalescer ? coalescer->coalescedReads() : 0;
+}
+
+// looked up in the cache's per-Kind table, only a Kind that hasn't been seen by
+// getOrCreateKind() / getDefaultKind() yet is decided here on its first miss
+bool KVStore::isCacheable(const Kind& kind) const noexcept {
+    std::optional<bool> known = cache->isCacheable(kind);
+    return known ? *known : cache->rememberCacheable(kind, allowsCaching(kind));
+}
+
+// entries of expiring Kinds or Kinds with a compaction filter are never cached since
+// they could outlive their expiry or removal by compaction in the cache
+bool KVStore::allowsCaching(const Kind& kind) const noexcept {
+    int status = Status::Ok;
+    KindOptions options = extended->getKindOptions(&status, kind);
+    if (status != Status::Ok || options.ttlSeconds > 0 || options.perEntryExpiry) {
+        return false;
+    }
+    bool filtered = extended->hasCompactionFilter(&status, kind);
+    return status == Status::Ok && !filtered;
+}
+
+void KVStore::invalidate(const Kind& kind, std::string_view key) noexcept {
+    if (coalescer) {
+        coalescer->detach(kind, key);
+    }
+    if (cache) {
+        cache->invalidate(kind, key);
+    }
+}
+
+void KVStore::invalidate(const Kind& kind) noexcept {
+    if (coalescer) {
+        coalescer->detach(kind);
+    }
+    if (cache) {
+        cache->invalidate(kind);
+    }
+}
+
+Compaction* KVStore::compactRange(const Kind& kind, std::string_view beginKeyInclusive,
+    std::string_view endKeyExclusive, int targetLevel, unsigned int maxSubcompactions) {
+    int status = Status::Ok;
+    CompactionJob* job = extended->compactRange(&status, kind, beginKeyInclusive.data(), beginKeyInclusive.size(),
+        endKeyExclusive.data(), endKeyExclusive.size(), targetLevel, maxSubcompactions);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return new Compaction(job);
+}
+
+const Snapshot* KVStore::getSnapshot() {
+    int status = Status::Ok;
+    const Snapshot* snapshot = extended->getSnapshot(&status);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return snapshot;
+}
+
+void KVStore::releaseSnapshot(const Snapshot* snapshot) noexcept {
+    if (snapshot && extended) {
+        extended->releaseSnapshot(snapshot);
+    }
+}
+
+void KVStore::createCheckpoint(std::string_view dir) {
+    int status = Status::Ok;
+    extended->createCheckpoint(&status, std::string(dir).c_str());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+}
+
+BackupInfo KVStore::createBackup(std::string_view backupDir, bool flushBeforeBackup) {
+    int status = Status::Ok;
+    BackupInfo info = extended->createBackup(&status, std::string(backupDir).c_str(), flushBeforeBackup);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return info;
+}
+
+void KVStore::restoreBackup(std::string_view backupDir, std::string_view restoreDir, unsigned int backupId) {
+    int status = Status::Ok;
+    ::restoreBackup(&status, std::string(backupDir).c_str(), backupId, std::string(restoreDir).c_str());
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+}
+
+void KVStore::purgeOldBackups(std::string_view backupDir, unsigned int numToKeep) {
+    int status = Status::Ok;
+    ::purgeOldBackups(&status, std::string(backupDir).c_str(), numToKeep);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+}
+
+unsigned long long KVStore::latestSequenceNumber() const noexcept {
+    return extended->latestSequenceNumber();
+}
+
+ChangeStream* KVStore::openChangeStream(unsigned long long fromSequenceNumber) {
+    int status = Status::Ok;
+    ChangeFeed* feed = extended->openChangeFeed(&status, fromSequenceNumber);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return new ChangeStream(feed);
+}
+
+SstFileWriter* KVStore::createSstFileWriter(const Kind& kind) {
+    int status = Status::Ok;
+    SstWriter* writer = extended->createSstWriter(&status, kind);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    return new SstFileWriter(writer);
+}
+
+void KVStore::ingest(const Kind& kind, const std::vector<std::string>& filePaths, bool moveFiles) {
+    if (filePaths.empty()) {
+        return;
+    }
+    std::vector<const char*> paths;
+    paths.reserve(filePaths.size());
+    for (const std::string& path : filePaths) {
+        paths.push_back(path.c_str());
+    }
+    int status = Status::Ok;
+    extended->ingest(&status, kind, paths.data(), paths.size(), moveFiles);
+    if (status != Status::Ok) {
+        throwForStatus(status);
+    }
+    invalidate(kind);
+}
+
 
 bool KVStore::throwForStatus(int status) {
     if (status != Status::Ok) {
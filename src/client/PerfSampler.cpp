@@ -0,0 +1,73 @@
+
+#include <atomic>
+#include <chrono>
+#include "client/PerfSampler.h"
+
+namespace {
+    // ids are never reused, so a countdown left behind by a destroyed sampler is simply taken over
+    std::atomic<unsigned long long> nextSamplerId{ 1 };
+
+    // every thread keeps a countdown per sampler, samplers whose ids are COUNTDOWN_SLOTS
+    // apart share a slot and restart each other's countdown (a thread rarely uses that many)
+    constexpr size_t COUNTDOWN_SLOTS = 8;
+
+    struct Countdown {
+        unsigned long long sampler = 0;
+        unsigned int remaining = 0;
+    };
+
+    thread_local Countdown countdowns[COUNTDOWN_SLOTS];
+    thread_local bool pending = false;
+    thread_local PerfSample last;
+
+    long long nowNanos() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
+
+PerfSampler::PerfSampler(unsigned int interval) noexcept
+    : id(nextSamplerId.fetch_add(1, std::memory_order_relaxed)), interval(interval > 0 ? interval : 1) {
+}
+
+bool PerfSampler::shouldSample() const noexcept {
+    pending = false;
+    Countdown& countdown = countdowns[id % COUNTDOWN_SLOTS];
+    if (countdown.sampler != id) {
+        countdown.sampler = id;
+        countdown.remaining = 0;
+    }
+    if (countdown.remaining == 0) {
+        countdown.remaining = interval - 1;
+        return true;
+    }
+    --countdown.remaining;
+    return false;
+}
+
+void PerfSampler::publish(const PerfSample& sample) noexcept {
+    last = sample;
+    pending = true;
+}
+
+bool PerfSampler::take(PerfSample* sample) noexcept {
+    if (!pending) {
+        return false;
+    }
+    pending = false;
+    *sample = last;
+    return true;
+}
+
+void PerfScope::start(ExtendedStore* pStore) noexcept {
+    store = pStore;
+    store->beginPerfCapture();
+    startNanos = nowNanos();
+}
+
+void PerfScope::finish() noexcept {
+    long long elapsed = nowNanos() - startNanos;
+    PerfSample sample = store->endPerfCapture();
+    sample.elapsedNanos = elapsed > 0 ? static_cast<unsigned long long>(elapsed) : 0;
+    PerfSampler::publish(sample);
+}
@@ -0,0 +1,223 @@
+
+#include "client/ReadCache.h"
+#include <atomic>
+#include <cstring> // std::memcpy
+#include <functional>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+// approximate per-entry bookkeeping overhead charged against the capacity
+static constexpr size_t ENTRY_OVERHEAD = 96;
+
+struct Entry {
+    std::string cacheKey;
+    std::shared_ptr<const char[]> value;
+    size_t valLen;
+    const Kind* kind;
+};
+
+struct ReadCache::Shard {
+    std::mutex mutex;
+    // most recently used at the front
+    std::list<Entry> lru;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> index;
+    size_t usage = 0;
+    size_t capacity = 0;
+    std::atomic<unsigned long long> generation{ 0 };
+    std::atomic<unsigned long long> hits{ 0 };
+    std::atomic<unsigned long long> misses{ 0 };
+
+    void eraseLocked(std::list<Entry>::iterator it) noexcept {
+        usage -= it->cacheKey.size() + it->valLen + ENTRY_OVERHEAD;
+        index.erase(std::string_view(it->cacheKey));
+        lru.erase(it);
+    }
+};
+
+struct ReadCache::Policies {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<const Kind*, bool> cacheable;
+};
+
+// the Kind's address identifies the Kind (Kinds live as long as their store)
+static std::string makeCacheKey(const Kind& kind, std::string_view key) {
+    const Kind* pKind = &kind;
+    std::string cacheKey(sizeof(pKind) + key.size(), '\0');
+    std::memcpy(cacheKey.data(), &pKind, sizeof(pKind));
+    if (!key.empty()) {
+        std::memcpy(cacheKey.data() + sizeof(pKind), key.data(), key.size());
+    }
+    return cacheKey;
+}
+
+ReadCache::ReadCache(size_t capacityBytes, unsigned int numShardBits)
+    : shards(nullptr), policies(nullptr), numShards(size_t(1) << (numShardBits > 16 ? 16 : numShardBits)), capacity(capacityBytes) {
+    shards = new Shard[numShards];
+    policies = new Policies();
+    for (size_t i = 0; i < numShards; ++i) {
+        shards[i].capacity = capacity / numShards;
+    }
+}
+
+ReadCache::~ReadCache() {
+    delete policies;
+    policies = nullptr;
+    delete[] shards;
+    shards = nullptr;
+}
+
+ReadCache::Shard& ReadCache::shardFor(const Kind& kind, std::string_view key) const noexcept {
+    size_t h = std::hash<std::string_view>()(key) ^ (reinterpret_cast<size_t>(&kind) >> 4);
+    return shards[h & (numShards - 1)];
+}
+
+std::shared_ptr<const char[]> ReadCache::lookup(const Kind& kind, std::string_view key, size_t* valLen) noexcept {
+    Shard& shard = shardFor(kind, key);
+    try {
+        std::string cacheKey = makeCacheKey(kind, key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.index.find(std::string_view(cacheKey));
+        if (found != shard.index.end()) {
+            shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            *valLen = found->second->valLen;
+            return found->second->value;
+        }
+    }
+    catch (...) {
+        // treat as a miss
+    }
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    return {};
+}
+
+unsigned long long ReadCache::generation(const Kind& kind, std::string_view key) const noexcept {
+    return shardFor(kind, key).generation.load(std::memory_order_acquire);
+}
+
+void ReadCache::fill(const Kind& kind, std::string_view key, std::shared_ptr<const char[]> value, size_t valLen,
+    unsigned long long generation) noexcept {
+    Shard& shard = shardFor(kind, key);
+    size_t charge = sizeof(const Kind*) + key.size() + valLen + ENTRY_OVERHEAD;
+    if (charge > shard.capacity) {
+        return;
+    }
+    try {
+        std::string cacheKey = makeCacheKey(kind, key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        // the key has been invalidated while the value was read from the store
+        if (shard.generation.load(std::memory_order_relaxed) != generation) {
+            return;
+        }
+        auto found = shard.index.find(std::string_view(cacheKey));
+        if (found != shard.index.end()) {
+            shard.eraseLocked(found->second);
+        }
+        while (shard.usage + charge > shard.capacity && !shard.lru.empty()) {
+            shard.eraseLocked(std::prev(shard.lru.end()));
+        }
+        shard.lru.push_front(Entry{ std::move(cacheKey), std::move(value), valLen, &kind });
+        try {
+            // the string_view key refers to the Entry's own std::string which never moves
+            shard.index.emplace(std::string_view(shard.lru.front().cacheKey), shard.lru.begin());
+        }
+        catch (...) {
+            shard.lru.pop_front();
+            throw;
+        }
+        shard.usage += charge;
+    }
+    catch (...) {
+        // caching is best-effort
+    }
+}
+
+void ReadCache::invalidate(const Kind& kind, std::string_view key) noexcept {
+    Shard& shard = shardFor(kind, key);
+    try {
+        std::string cacheKey = makeCacheKey(kind, key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.generation.fetch_add(1, std::memory_order_acq_rel);
+        auto found = shard.index.find(std::string_view(cacheKey));
+        if (found != shard.index.end()) {
+            shard.eraseLocked(found->second);
+        }
+    }
+    catch (...) {
+        // std::string allocation failed, fall back to dropping everything
+        clear();
+    }
+}
+
+void ReadCache::invalidate(const Kind& kind) noexcept {
+    for (size_t i = 0; i < numShards; ++i) {
+        Shard& shard = shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.generation.fetch_add(1, std::memory_order_acq_rel);
+        for (auto it = shard.lru.begin(); it != shard.lru.end();) {
+            auto next = std::next(it);
+            if (it->kind == &kind) {
+                shard.eraseLocked(it);
+            }
+            it = next;
+        }
+    }
+}
+
+void ReadCache::clear() noexcept {
+    for (size_t i = 0; i < numShards; ++i) {
+        Shard& shard = shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.generation.fetch_add(1, std::memory_order_acq_rel);
+        shard.index.clear();
+        shard.lru.clear();
+        shard.usage = 0;
+    }
+}
+
+std::optional<bool> ReadCache::isCacheable(const Kind& kind) const noexcept {
+    std::shared_lock<std::shared_mutex> lock(policies->mutex);
+    auto found = policies->cacheable.find(&kind);
+    if (found == policies->cacheable.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+bool ReadCache::rememberCacheable(const Kind& kind, bool cacheable) noexcept {
+    std::unique_lock<std::shared_mutex> lock(policies->mutex);
+    try {
+        return policies->cacheable.emplace(&kind, cacheable).first->second;
+    }
+    catch (...) {
+        // decided again on the next miss
+        return false;
+    }
+}
+
+void ReadCache::setCacheable(const Kind& kind, bool cacheable) noexcept {
+    std::unique_lock<std::shared_mutex> lock(policies->mutex);
+    try {
+        policies->cacheable[&kind] = cacheable;
+    }
+    catch (...) {
+        // without an entry the Kind is decided again on its next miss
+    }
+}
+
+ReadCacheStats ReadCache::stats() const noexcept {
+    ReadCacheStats stats;
+    stats.capacity = capacity;
+    for (size_t i = 0; i < numShards; ++i) {
+        Shard& shard = shards[i];
+        stats.hits += shard.hits.load(std::memory_order_relaxed);
+        stats.misses += shard.misses.load(std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.entries += shard.lru.size();
+        stats.usage += shard.usage;
+    }
+    return stats;
+}
@@ -0,0 +1,157 @@
+
+#include "client/ReadCoalescer.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstring> // std::memcpy
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+struct ReadCoalescer::Flight {
+    Shard* shard = nullptr;
+    std::string flightKey;
+    std::condition_variable completed;
+    bool done = false;
+    // guarded by the shard's mutex
+    int refs = 1;
+    std::shared_ptr<const char[]> value;
+    size_t valLen = 0;
+    int status = 0;
+};
+
+struct ReadCoalescer::Shard {
+    std::mutex mutex;
+    std::unordered_map<std::string, Flight*> flights;
+    std::atomic<unsigned long long> coalesced{ 0 };
+};
+
+// the Kind's address identifies the Kind (Kinds live as long as their store)
+static std::string makeFlightKey(const Kind& kind, std::string_view key) {
+    const Kind* pKind = &kind;
+    std::string flightKey(sizeof(pKind) + key.size(), '\0');
+    std::memcpy(flightKey.data(), &pKind, sizeof(pKind));
+    if (!key.empty()) {
+        std::memcpy(flightKey.data() + sizeof(pKind), key.data(), key.size());
+    }
+    return flightKey;
+}
+
+ReadCoalescer::ReadCoalescer(unsigned int numShardBits)
+    : shards(nullptr), numShards(size_t(1) << (numShardBits > 16 ? 16 : numShardBits)) {
+    shards = new Shard[numShards];
+}
+
+ReadCoalescer::~ReadCoalescer() {
+    // there can't be any flights left as every get() finishes or awaits its flight
+    delete[] shards;
+    shards = nullptr;
+}
+
+ReadCoalescer::Shard& ReadCoalescer::shardFor(const Kind& kind, std::string_view key) const noexcept {
+    size_t h = std::hash<std::string_view>()(key) ^ (reinterpret_cast<size_t>(&kind) >> 4);
+    return shards[h & (numShards - 1)];
+}
+
+ReadCoalescer::Flight* ReadCoalescer::join(const Kind& kind, std::string_view key, bool* leader) {
+    Shard& shard = shardFor(kind, key);
+    std::string flightKey = makeFlightKey(kind, key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.flights.find(flightKey);
+    if (found != shard.flights.end()) {
+        Flight* flight = found->second;
+        ++flight->refs;
+        shard.coalesced.fetch_add(1, std::memory_order_relaxed);
+        *leader = false;
+        return flight;
+    }
+    Flight* flight = new Flight();
+    flight->shard = &shard;
+    flight->flightKey = flightKey;
+    try {
+        shard.flights.emplace(std::move(flightKey), flight);
+    }
+    catch (...) {
+        delete flight;
+        throw;
+    }
+    *leader = true;
+    return flight;
+}
+
+void ReadCoalescer::finish(Flight* flight, std::shared_ptr<const char[]> value, size_t valLen, int status) noexcept {
+    Shard& shard = *flight->shard;
+    bool last = false;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto found = shard.flights.find(flight->flightKey);
+        // the flight may have been detached (and replaced) in the meantime
+        if (found != shard.flights.end() && found->second == flight) {
+            shard.flights.erase(found);
+        }
+        flight->value = std::move(value);
+        flight->valLen = valLen;
+        flight->status = status;
+        flight->done = true;
+        last = --flight->refs == 0;
+        // notify under the lock, a woken follower may delete the flight right after we unlock
+        flight->completed.notify_all();
+    }
+    if (last) {
+        delete flight;
+    }
+}
+
+std::shared_ptr<const char[]> ReadCoalescer::await(Flight* flight, size_t* valLen, int* status) noexcept {
+    Shard& shard = *flight->shard;
+    std::shared_ptr<const char[]> value;
+    bool last = false;
+    {
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        flight->completed.wait(lock, [flight] { return flight->done; });
+        value = flight->value;
+        *valLen = flight->valLen;
+        *status = flight->status;
+        last = --flight->refs == 0;
+    }
+    if (last) {
+        delete flight;
+    }
+    return value;
+}
+
+void ReadCoalescer::detach(const Kind& kind, std::string_view key) noexcept {
+    Shard& shard = shardFor(kind, key);
+    try {
+        std::string flightKey = makeFlightKey(kind, key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.flights.erase(flightKey);
+    }
+    catch (...) {
+        // std::string allocation failed, the flight simply completes as usual
+    }
+}
+
+void ReadCoalescer::detach(const Kind& kind) noexcept {
+    const Kind* pKind = &kind;
+    for (size_t i = 0; i < numShards; ++i) {
+        Shard& shard = shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.flights.begin(); it != shard.flights.end();) {
+            if (std::memcmp(it->first.data(), &pKind, sizeof(pKind)) == 0) {
+                it = shard.flights.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+}
+
+unsigned long long ReadCoalescer::coalescedReads() const noexcept {
+    unsigned long long total = 0;
+    for (size_t i = 0; i < numShards; ++i) {
+        total += shards[i].coalesced.load(std::memory_order_relaxed);
+    }
+    return total;
+}
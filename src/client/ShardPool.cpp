@@ -0,0 +1,124 @@
+
+#include "client/ShardPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace {
+    // the completion state of one run() call, lives on the caller's stack
+    struct Batch {
+        std::mutex mutex;
+        std::condition_variable done;
+        size_t pending = 0;
+    };
+
+    struct Job {
+        ShardPool::Task task;
+        void* context;
+        Batch* batch;
+    };
+
+    struct Worker {
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+        std::deque<Job> jobs;
+        bool stopping = false;
+        std::thread thread;
+        std::atomic<unsigned long long> operations{ 0 };
+        std::atomic<unsigned long long> failedOperations{ 0 };
+        std::atomic<int> lastErrorStatus{ Status::Ok };
+    };
+}
+
+struct ShardPool::Impl {
+    std::deque<Worker> workers;
+
+    void work(size_t shard) noexcept {
+        Worker& worker = workers[shard];
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(worker.mutex);
+                worker.wakeUp.wait(lock, [&worker] { return worker.stopping || !worker.jobs.empty(); });
+                if (worker.jobs.empty()) {
+                    return;
+                }
+                job = worker.jobs.front();
+                worker.jobs.pop_front();
+            }
+            job.task(job.context, shard);
+            std::lock_guard<std::mutex> lock(job.batch->mutex);
+            if (--job.batch->pending == 0) {
+                job.batch->done.notify_one();
+            }
+        }
+    }
+};
+
+ShardPool::ShardPool(size_t numShards) : impl(new Impl()) {
+    impl->workers.resize(numShards);
+    for (size_t i = 0; i < numShards; ++i) {
+        impl->workers[i].thread = std::thread(&Impl::work, impl, i);
+    }
+}
+
+ShardPool::~ShardPool() {
+    for (Worker& worker : impl->workers) {
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.stopping = true;
+        }
+        worker.wakeUp.notify_one();
+    }
+    for (Worker& worker : impl->workers) {
+        worker.thread.join();
+    }
+    delete impl;
+    impl = nullptr;
+}
+
+void ShardPool::run(const std::vector<size_t>& shards, Task task, void* context) noexcept {
+    if (shards.size() == 1) {
+        task(context, shards[0]);
+        return;
+    }
+    Batch batch;
+    batch.pending = shards.size();
+    for (size_t shard : shards) {
+        Worker& worker = impl->workers[shard];
+        try {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.jobs.push_back(Job{ task, context, &batch });
+        }
+        catch (...) {
+            // couldn't be queued, do it here
+            task(context, shard);
+            std::lock_guard<std::mutex> lock(batch.mutex);
+            --batch.pending;
+            continue;
+        }
+        worker.wakeUp.notify_one();
+    }
+    std::unique_lock<std::mutex> lock(batch.mutex);
+    batch.done.wait(lock, [&batch] { return batch.pending == 0; });
+}
+
+void ShardPool::count(size_t shard, int status) noexcept {
+    Worker& worker = impl->workers[shard];
+    worker.operations.fetch_add(1, std::memory_order_relaxed);
+    if (!(status == Status::Ok || status == Status::NotFound || status == Status::AlreadyExists)) {
+        worker.failedOperations.fetch_add(1, std::memory_order_relaxed);
+        worker.lastErrorStatus.store(status, std::memory_order_relaxed);
+    }
+}
+
+ShardCounters ShardPool::counters(size_t shard) const noexcept {
+    const Worker& worker = impl->workers[shard];
+    ShardCounters counters;
+    counters.operations = worker.operations.load(std::memory_order_relaxed);
+    counters.failedOperations = worker.failedOperations.load(std::memory_order_relaxed);
+    counters.lastErrorStatus = worker.lastErrorStatus.load(std::memory_order_relaxed);
+    return counters;
+}
@@ -0,0 +1,101 @@
+
+#include "client/ShardRouter.h"
+#include <algorithm>
+#include <string>
+
+namespace {
+    constexpr unsigned long long FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+    constexpr unsigned long long FNV_PRIME = 0x100000001b3ULL;
+
+    // 64-bit FNV-1a, spelled out instead of std::hash (whose result is up to the
+    // standard library) because the placement of the keys is persistent
+    unsigned long long fnv1a(std::string_view bytes) noexcept {
+        unsigned long long h = FNV_OFFSET_BASIS;
+        for (char c : bytes) {
+            h ^= static_cast<unsigned char>(c);
+            h *= FNV_PRIME;
+        }
+        return h;
+    }
+
+    // the MurmurHash3 finalizer, spreads FNV-1a (which is weak in the high bits) over the whole ring
+    unsigned long long mix(unsigned long long h) noexcept {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    unsigned long long hashOf(std::string_view bytes) noexcept {
+        return mix(fnv1a(bytes));
+    }
+}
+
+bool ShardRouter::init(ShardRouting routing, const std::vector<std::string>& paths,
+    const std::vector<std::string>& splitKeys, unsigned int virtualNodes) {
+    mode = routing;
+    numShards = paths.size();
+    ring.clear();
+    splits.clear();
+    if (numShards == 0) {
+        return false;
+    }
+    if (routing == ShardRouting::Range) {
+        if (splitKeys.size() != numShards - 1 || !std::is_sorted(splitKeys.begin(), splitKeys.end())
+            || std::adjacent_find(splitKeys.begin(), splitKeys.end()) != splitKeys.end()) {
+            return false;
+        }
+        splits = splitKeys;
+        return true;
+    }
+    unsigned int points = virtualNodes > 0 ? virtualNodes : 1;
+    ring.reserve(numShards * points);
+    for (size_t shard = 0; shard < numShards; ++shard) {
+        for (unsigned int i = 0; i < points; ++i) {
+            ring.emplace_back(hashOf("shard#" + std::to_string(shard) + '#' + std::to_string(i)), shard);
+        }
+    }
+    std::sort(ring.begin(), ring.end());
+    return true;
+}
+
+size_t ShardRouter::shardFor(std::string_view key) const noexcept {
+    if (mode == ShardRouting::Range) {
+        return static_cast<size_t>(std::upper_bound(splits.begin(), splits.end(), key,
+            [](std::string_view k, const std::string& split) { return k < split; }) - splits.begin());
+    }
+    unsigned long long h = hashOf(key);
+    auto it = std::upper_bound(ring.begin(), ring.end(), h,
+        [](unsigned long long point, const std::pair<unsigned long long, size_t>& node) { return point < node.first; });
+    // wraps around to the first point
+    return it == ring.end() ? ring.front().second : it->second;
+}
+
+std::vector<size_t> ShardRouter::shardsFor(std::string_view beginKeyInclusive,
+    std::string_view endKeyExclusive) const {
+    if (mode != ShardRouting::Range) {
+        return allShards();
+    }
+    size_t first = beginKeyInclusive.data() ? shardFor(beginKeyInclusive) : 0;
+    size_t last = numShards - 1;
+    if (endKeyExclusive.data()) {
+        // a range that ends at a split key doesn't reach into the shard that starts there
+        last = static_cast<size_t>(std::lower_bound(splits.begin(), splits.end(), endKeyExclusive,
+            [](const std::string& split, std::string_view k) { return split < k; }) - splits.begin());
+    }
+    std::vector<size_t> shards;
+    for (size_t shard = first; shard <= last; ++shard) {
+        shards.push_back(shard);
+    }
+    return shards;
+}
+
+std::vector<size_t> ShardRouter::allShards() const {
+    std::vector<size_t> shards(numShards);
+    for (size_t shard = 0; shard < numShards; ++shard) {
+        shards[shard] = shard;
+    }
+    return shards;
+}
@@ -0,0 +1,397 @@
+
+#include <algorithm>
+#include <optional>
+#include <set>
+#include <type_traits>
+#include "client/ShardedKVStore.h"
+#include "../RocksDbException.h"
+
+using namespace System;
+
+namespace {
+    struct FanOutContext {
+        const std::function<void(size_t shard)>* op;
+        std::vector<int> statuses;
+    };
+
+    // executed by the shard workers, so nothing may escape
+    void fanOutTask(void* context, size_t shard) noexcept {
+        FanOutContext* ctx = static_cast<FanOutContext*>(context);
+        try {
+            (*ctx->op)(shard);
+        }
+        catch (RocksDbException^ e) {
+            ctx->statuses[shard] = e->Code;
+        }
+        catch (...) {
+            ctx->statuses[shard] = Status::Unknown;
+        }
+    }
+
+    // runs a single-key operation on the key's shard and counts it for the shard's health
+    template <typename Op>
+    auto counted(ShardPool& pool, size_t shard, Op&& op) {
+        try {
+            if constexpr (std::is_void_v<std::invoke_result_t<Op>>) {
+                op();
+                pool.count(shard, Status::Ok);
+            }
+            else {
+                auto result = op();
+                pool.count(shard, Status::Ok);
+                return result;
+            }
+        }
+        catch (RocksDbException^ e) {
+            pool.count(shard, e->Code);
+            throw;
+        }
+    }
+}
+
+ShardedKVStore::ShardedKVStore(const std::vector<std::string>& paths, const ShardedKVStoreOptions& options)
+    : paths(paths), shards(paths.size(), nullptr), pool(nullptr) {
+    if (std::set<std::string>(paths.begin(), paths.end()).size() != paths.size()
+        || !router.init(options.routing, paths, options.splitKeys, options.virtualNodes)) {
+        KVStore::throwForStatus(Status::InvalidArgument);
+    }
+    pool = new ShardPool(paths.size());
+    try {
+        // the shards recover in parallel
+        fanOut(router.allShards(), [this, &options](size_t shard) {
+            KVStoreOptions shardOptions = options.storeOptions;
+            if (!shardOptions.traceFile.empty()) {
+                shardOptions.traceFile += "." + std::to_string(shard);
+            }
+            if (!shardOptions.secondaryPath.empty()) {
+                shardOptions.secondaryPath += "." + std::to_string(shard);
+            }
+            this->shards[shard] = new KVStore(this->paths[shard], shardOptions);
+        });
+    }
+    catch (...) {
+        // the destructor won't run for a constructor that throws
+        for (KVStore*& shard : shards) {
+            delete shard;
+            shard = nullptr;
+        }
+        delete pool;
+        pool = nullptr;
+        throw;
+    }
+}
+
+ShardedKVStore::~ShardedKVStore() {
+    // the workers must be gone before the shards
+    delete pool;
+    pool = nullptr;
+    for (KVStore*& shard : shards) {
+        delete shard;
+        shard = nullptr;
+    }
+}
+
+size_t ShardedKVStore::shardCount() const noexcept {
+    return shards.size();
+}
+
+size_t ShardedKVStore::shardFor(std::string_view key) const noexcept {
+    return router.shardFor(key);
+}
+
+KVStore& ShardedKVStore::shard(size_t shard) const {
+    if (shard >= shards.size()) {
+        KVStore::throwForStatus(Status::InvalidArgument);
+    }
+    return *shards[shard];
+}
+
+void ShardedKVStore::fanOut(const std::vector<size_t>& targets, const ShardOp& op) const {
+    if (targets.empty()) {
+        return;
+    }
+    FanOutContext context{ &op, std::vector<int>(shards.size(), Status::Ok) };
+    pool->run(targets, &fanOutTask, &context);
+    int failed = Status::Ok;
+    for (size_t shard : targets) {
+        int status = context.statuses[shard];
+        pool->count(shard, status);
+        if (failed == Status::Ok && status != Status::Ok) {
+            failed = status;
+        }
+    }
+    if (failed != Status::Ok) {
+        KVStore::throwForStatus(failed);
+    }
+}
+
+void ShardedKVStore::put(const ShardedKind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    counted(*pool, shard, [&] { shards[shard]->put(kind.on(shard), key, value, options); });
+}
+
+bool ShardedKVStore::tryPut(const ShardedKind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->tryPut(kind.on(shard), key, value, options); });
+}
+
+void ShardedKVStore::remove(const ShardedKind& kind, std::string_view key, const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    counted(*pool, shard, [&] { shards[shard]->remove(kind.on(shard), key, options); });
+}
+
+bytes ShardedKVStore::get(const ShardedKind& kind, std::string_view key) const {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->get(kind.on(shard), key); });
+}
+
+bytes ShardedKVStore::get(const ShardedKind& kind, std::string_view key, const ReadOptions& options) const {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->get(kind.on(shard), key, options); });
+}
+
+bool ShardedKVStore::contains(const ShardedKind& kind, std::string_view key) const {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->contains(kind.on(shard), key); });
+}
+
+bytes ShardedKVStore::updateIfPresent(const ShardedKind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->updateIfPresent(kind.on(shard), key, value, options); });
+}
+
+void ShardedKVStore::singleRemove(const ShardedKind& kind, std::string_view key, const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    counted(*pool, shard, [&] { shards[shard]->singleRemove(kind.on(shard), key, options); });
+}
+
+bytes ShardedKVStore::removeIfPresent(const ShardedKind& kind, std::string_view key, const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->removeIfPresent(kind.on(shard), key, options); });
+}
+
+bool ShardedKVStore::putIfAbsent(const ShardedKind& kind, std::string_view key, std::string_view value,
+    const WriteOptions& options) {
+    size_t shard = router.shardFor(key);
+    return counted(*pool, shard, [&] { return shards[shard]->putIfAbsent(kind.on(shard), key, value, options); });
+}
+
+std::vector<bytes> ShardedKVStore::multiGet(const ShardedKind& kind, const std::vector<std::string_view>& keys,
+    const ReadOptions& options) const {
+    std::vector<size_t> route(keys.size());
+    std::vector<std::vector<std::string_view>> shardKeys(shards.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        route[i] = router.shardFor(keys[i]);
+        shardKeys[route[i]].push_back(keys[i]);
+    }
+    std::vector<size_t> targets;
+    for (size_t shard = 0; shard < shards.size(); ++shard) {
+        if (!shardKeys[shard].empty()) {
+            targets.push_back(shard);
+        }
+    }
+    std::vector<std::vector<bytes>> shardValues(shards.size());
+    fanOut(targets, [&](size_t shard) {
+        shardValues[shard] = shards[shard]->multiGet(kind.on(shard), shardKeys[shard], nullptr, options);
+    });
+    // every shard returned its values in the order of its keys
+    std::vector<size_t> next(shards.size(), 0);
+    std::vector<bytes> values;
+    values.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        values.push_back(std::move(shardValues[route[i]][next[route[i]]++]));
+    }
+    return values;
+}
+
+bytes ShardedKVStore::findMinKey(const ShardedKind& kind, const ReadOptions& options) const {
+    std::vector<std::optional<bytes>> minKeys(shards.size());
+    fanOut(router.allShards(), [&](size_t shard) {
+        minKeys[shard] = shards[shard]->findMinKey(kind.on(shard), options);
+    });
+    size_t best = 0;
+    for (size_t shard = 1; shard < shards.size(); ++shard) {
+        const bytes& key = *minKeys[shard];
+        if (key && (!*minKeys[best] || std::string_view(key.data(), key.size())
+            < std::string_view(minKeys[best]->data(), minKeys[best]->size()))) {
+            best = shard;
+        }
+    }
+    return std::move(*minKeys[best]);
+}
+
+bytes ShardedKVStore::findMaxKey(const ShardedKind& kind, const ReadOptions& options) const {
+    std::vector<std::optional<bytes>> maxKeys(shards.size());
+    fanOut(router.allShards(), [&](size_t shard) {
+        maxKeys[shard] = shards[shard]->findMaxKey(kind.on(shard), options);
+    });
+    size_t best = 0;
+    for (size_t shard = 1; shard < shards.size(); ++shard) {
+        const bytes& key = *maxKeys[shard];
+        if (key && (!*maxKeys[best] || std::string_view(key.data(), key.size())
+            > std::string_view(maxKeys[best]->data(), maxKeys[best]->size()))) {
+            best = shard;
+        }
+    }
+    return std::move(*maxKeys[best]);
+}
+
+void ShardedKVStore::removeRange(const ShardedKind& kind, std::string_view beginKeyInclusive,
+    std::string_view endKeyExclusive, const WriteOptions& options) {
+    fanOut(router.shardsFor(beginKeyInclusive, endKeyExclusive), [&](size_t shard) {
+        shards[shard]->removeRange(kind.on(shard), beginKeyInclusive, endKeyExclusive, options);
+    });
+}
+
+void ShardedKVStore::purgeRange(const ShardedKind& kind, std::string_view beginKeyInclusive,
+    std::string_view endKeyExclusive, bool compactBoundaries, const WriteOptions& options) {
+    fanOut(router.shardsFor(beginKeyInclusive, endKeyExclusive), [&](size_t shard) {
+        shards[shard]->purgeRange(kind.on(shard), beginKeyInclusive, endKeyExclusive, compactBoundaries, options);
+    });
+}
+
+unsigned long long ShardedKVStore::approximateSize(const ShardedKind& kind, std::string_view beginKeyInclusive,
+    std::string_view endKeyExclusive) const {
+    std::vector<unsigned long long> sizes(shards.size(), 0);
+    fanOut(router.shardsFor(beginKeyInclusive, endKeyExclusive), [&](size_t shard) {
+        sizes[shard] = shards[shard]->approximateSize(kind.on(shard), beginKeyInclusive, endKeyExclusive);
+    });
+    unsigned long long total = 0;
+    for (unsigned long long size : sizes) {
+        total += size;
+    }
+    return total;
+}
+
+unsigned long long ShardedKVStore::estimateNumKeys(const ShardedKind& kind) const {
+    unsigned long long total = 0;
+    for (unsigned long long numKeys : estimateNumKeysPerShard(kind)) {
+        total += numKeys;
+    }
+    return total;
+}
+
+std::vector<unsigned long long> ShardedKVStore::estimateNumKeysPerShard(const ShardedKind& kind) const {
+    std::vector<unsigned long long> numKeys(shards.size(), 0);
+    fanOut(router.allShards(), [&](size_t shard) {
+        numKeys[shard] = shards[shard]->estimateNumKeys(kind.on(shard));
+    });
+    return numKeys;
+}
+
+void ShardedKVStore::compact(const ShardedKind& kind) {
+    fanOut(router.allShards(), [&](size_t shard) {
+        shards[shard]->compact(kind.on(shard));
+    });
+}
+
+void ShardedKVStore::compactAll() {
+    fanOut(router.allShards(), [this](size_t shard) {
+        shards[shard]->compactAll();
+    });
+}
+
+void ShardedKVStore::close() {
+    for (KVStore* shard : shards) {
+        shard->close();
+    }
+}
+
+bool ShardedKVStore::isOpen() const noexcept {
+    for (KVStore* shard : shards) {
+        if (!shard->isOpen()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ShardedKVStore::tryCatchUpWithPrimary() {
+    fanOut(router.allShards(), [this](size_t shard) {
+        shards[shard]->tryCatchUpWithPrimary();
+    });
+}
+
+ShardedKind ShardedKVStore::resolve(std::string_view kindName,
+    const std::function<const Kind&(KVStore& store)>& kindOf) {
+    ShardedKind kind;
+    kind.kindName = std::string(kindName);
+    kind.kinds.resize(shards.size(), nullptr);
+    fanOut(router.allShards(), [&](size_t shard) {
+        kind.kinds[shard] = &kindOf(*shards[shard]);
+    });
+    return kind;
+}
+
+ShardedKind ShardedKVStore::getDefaultKind() const {
+    ShardedKind kind;
+    kind.kinds.reserve(shards.size());
+    for (KVStore* shard : shards) {
+        kind.kinds.push_back(&shard->getDefaultKind());
+    }
+    kind.kindName = kind.kinds.front()->name();
+    return kind;
+}
+
+ShardedKind ShardedKVStore::getOrCreateKind(std::string_view kindName) {
+    return resolve(kindName, [kindName](KVStore& store) -> const Kind& {
+        return store.getOrCreateKind(kindName);
+    });
+}
+
+ShardedKind ShardedKVStore::getOrCreateKind(std::string_view kindName, const KindOptions& options) {
+    return resolve(kindName, [kindName, &options](KVStore& store) -> const Kind& {
+        return store.getOrCreateKind(kindName, options);
+    });
+}
+
+std::vector<ShardedKind> ShardedKVStore::getKinds() const {
+    std::vector<std::map<std::string, const Kind*>> byName(shards.size());
+    for (size_t shard = 0; shard < shards.size(); ++shard) {
+        for (const Kind& kind : shards[shard]->getKinds()) {
+            byName[shard].emplace(kind.name(), &kind);
+        }
+    }
+    std::vector<ShardedKind> kinds;
+    for (const auto& [name, first] : byName.front()) {
+        ShardedKind kind;
+        kind.kindName = name;
+        kind.kinds.push_back(first);
+        for (size_t shard = 1; shard < shards.size(); ++shard) {
+            auto found = byName[shard].find(name);
+            if (found == byName[shard].end()) {
+                break;
+            }
+            kind.kinds.push_back(found->second);
+        }
+        if (kind.kinds.size() == shards.size()) {
+            kinds.push_back(std::move(kind));
+        }
+    }
+    return kinds;
+}
+
+std::vector<ShardHealth> ShardedKVStore::getShardHealth() const {
+    std::vector<ShardHealth> health(shards.size());
+    for (size_t shard = 0; shard < shards.size(); ++shard) {
+        ShardCounters counters = pool->counters(shard);
+        health[shard].path = paths[shard];
+        health[shard].open = shards[shard]->isOpen();
+        health[shard].operations = counters.operations;
+        health[shard].failedOperations = counters.failedOperations;
+        health[shard].lastErrorStatus = counters.lastErrorStatus;
+        health[shard].recovery = shards[shard]->recoveryReport();
+        if (health[shard].open) {
+            try {
+                health[shard].memoryUsage = shards[shard]->memoryUsage();
+            }
+            catch (RocksDbException^) {
+                // closed concurrently
+            }
+        }
+    }
+    return health;
+}
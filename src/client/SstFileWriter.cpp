@@ -0,0 +1,44 @@
+
+#include <string>
+#include "client/SstFileWriter.h"
+#include "client/KVStore.h"
+
+SstFileWriter::~SstFileWriter() {
+    if (writer) {
+        delete writer;
+        writer = nullptr;
+    }
+}
+
+void SstFileWriter::open(std::string_view filePath) {
+    int status = Status::Ok;
+    // create a copy of filePath to ensure null-termination
+    writer->open(&status, std::string(filePath).c_str());
+    if (status != Status::Ok) {
+        KVStore::throwForStatus(status);
+    }
+}
+
+void SstFileWriter::put(std::string_view key, std::string_view value) {
+    int status = Status::Ok;
+    writer->put(&status, key.data(), key.size(), value.data(), value.size());
+    if (status != Status::Ok) {
+        KVStore::throwForStatus(status);
+    }
+}
+
+void SstFileWriter::finish() {
+    int status = Status::Ok;
+    writer->finish(&status);
+    if (status != Status::Ok) {
+        KVStore::throwForStatus(status);
+    }
+}
+
+unsigned long long SstFileWriter::fileSize() const noexcept {
+    return writer->fileSize();
+}
+
+unsigned long long SstFileWriter::numEntries() const noexcept {
+    return writer->numEntries();
+}
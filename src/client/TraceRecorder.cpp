@@ -0,0 +1,214 @@
+
+#include "client/TraceRecorder.h"
+#include "api/StatusCode.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring> // std::memcpy
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr char MAGIC[8] = { 'L', 'R', 'T', 'R', 'A', 'C', 'E', '1' };
+    constexpr size_t RING_CAPACITY = 256 * 1024;
+    constexpr size_t RECORD_HEADER_SIZE = 1 + 4 + 4 + 8 + 4 + 4;
+
+    // ids are never reused, so a thread's stale ring of a destroyed recorder can't be mistaken for a live one
+    std::atomic<unsigned long long> nextRecorderId { 1 };
+
+    // ids of the recorders that haven't been destroyed yet, only consulted when a thread needs a new ring
+    std::mutex liveRecordersMutex;
+    std::unordered_set<unsigned long long> liveRecorders;
+
+    struct Ring {
+        char data[RING_CAPACITY];
+        // head is only advanced by the producer, tail only by the drainer
+        std::atomic<size_t> head { 0 };
+        std::atomic<size_t> tail { 0 };
+        unsigned int thread = 0;
+        Ring* next = nullptr;
+        // only touched by the producer
+        std::unordered_map<const Kind*, unsigned int> kindIds;
+    };
+
+    thread_local std::vector<std::pair<unsigned long long, Ring*>> threadRings;
+
+    // drops the entries whose recorder (and with it the ring) is gone, so a long-lived
+    // thread that has seen many recorders doesn't keep a growing list of dangling rings
+    void pruneThreadRings() {
+        std::lock_guard<std::mutex> lock(liveRecordersMutex);
+        threadRings.erase(std::remove_if(threadRings.begin(), threadRings.end(),
+            [](const std::pair<unsigned long long, Ring*>& entry) { return liveRecorders.count(entry.first) == 0; }),
+            threadRings.end());
+    }
+
+    void copyIn(Ring* ring, size_t pos, const char* src, size_t len) noexcept {
+        size_t offset = pos % RING_CAPACITY;
+        size_t first = std::min(len, RING_CAPACITY - offset);
+        std::memcpy(ring->data + offset, src, first);
+        if (first < len) {
+            std::memcpy(ring->data, src + first, len - first);
+        }
+    }
+
+    template <typename T>
+    char* put(char* dest, T value) noexcept {
+        std::memcpy(dest, &value, sizeof(T));
+        return dest + sizeof(T);
+    }
+}
+
+struct TraceRecorder::Impl {
+    std::FILE* file = nullptr;
+    unsigned long long id = nextRecorderId.fetch_add(1);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::atomic<Ring*> rings { nullptr };
+    std::atomic<unsigned int> nextThread { 0 };
+    std::atomic<unsigned int> nextKindId { 0 };
+    std::atomic<unsigned long long> dropped { 0 };
+    std::atomic<bool> running { false };
+    std::thread drainer;
+
+    Ring* ringOfThisThread() {
+        for (const auto& entry : threadRings) {
+            if (entry.first == id) {
+                return entry.second;
+            }
+        }
+        pruneThreadRings();
+        Ring* ring = new Ring();
+        ring->thread = nextThread.fetch_add(1);
+        Ring* first = rings.load(std::memory_order_relaxed);
+        do {
+            ring->next = first;
+        } while (!rings.compare_exchange_weak(first, ring, std::memory_order_release, std::memory_order_relaxed));
+        threadRings.emplace_back(id, ring);
+        return ring;
+    }
+
+    bool append(Ring* ring, TraceOp op, unsigned int kindId, std::string_view key, size_t valueSize) noexcept {
+        size_t need = RECORD_HEADER_SIZE + key.size();
+        size_t head = ring->head.load(std::memory_order_relaxed);
+        size_t tail = ring->tail.load(std::memory_order_acquire);
+        if (need > RING_CAPACITY - (head - tail)) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        unsigned long long micros = static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        char header[RECORD_HEADER_SIZE];
+        char* p = put(header, static_cast<unsigned char>(op));
+        p = put(p, ring->thread);
+        p = put(p, kindId);
+        p = put(p, micros);
+        p = put(p, static_cast<unsigned int>(key.size()));
+        put(p, static_cast<unsigned int>(valueSize));
+        copyIn(ring, head, header, RECORD_HEADER_SIZE);
+        copyIn(ring, head + RECORD_HEADER_SIZE, key.data(), key.size());
+        ring->head.store(head + need, std::memory_order_release);
+        return true;
+    }
+
+    size_t drain() noexcept {
+        size_t written = 0;
+        for (Ring* ring = rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+            size_t head = ring->head.load(std::memory_order_acquire);
+            size_t tail = ring->tail.load(std::memory_order_relaxed);
+            if (head == tail) {
+                continue;
+            }
+            size_t len = head - tail;
+            size_t offset = tail % RING_CAPACITY;
+            size_t first = std::min(len, RING_CAPACITY - offset);
+            std::fwrite(ring->data + offset, 1, first, file);
+            if (first < len) {
+                std::fwrite(ring->data, 1, len - first, file);
+            }
+            ring->tail.store(head, std::memory_order_release);
+            written += len;
+        }
+        return written;
+    }
+};
+
+TraceRecorder::TraceRecorder(int* status, std::string_view path) : impl(new Impl()) {
+    try {
+        std::lock_guard<std::mutex> lock(liveRecordersMutex);
+        liveRecorders.insert(impl->id);
+    }
+    catch (...) {
+        *status = Status::Unknown;
+        return;
+    }
+    impl->file = std::fopen(std::string(path).c_str(), "wb");
+    if (!impl->file || std::fwrite(MAGIC, 1, sizeof(MAGIC), impl->file) != sizeof(MAGIC)) {
+        *status = Status::IOError;
+        return;
+    }
+    impl->running.store(true);
+    Impl* self = impl;
+    impl->drainer = std::thread([self]() {
+        while (self->running.load(std::memory_order_acquire)) {
+            if (self->drain() == 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+    });
+}
+
+TraceRecorder::~TraceRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(liveRecordersMutex);
+        liveRecorders.erase(impl->id);
+    }
+    impl->running.store(false, std::memory_order_release);
+    if (impl->drainer.joinable()) {
+        impl->drainer.join();
+    }
+    if (impl->file) {
+        impl->drain();
+        std::fclose(impl->file);
+    }
+    Ring* ring = impl->rings.load();
+    while (ring) {
+        Ring* next = ring->next;
+        delete ring;
+        ring = next;
+    }
+    delete impl;
+}
+
+void TraceRecorder::record(TraceOp op, const Kind& kind, std::string_view key, size_t valueSize) noexcept {
+    if (!impl->running.load(std::memory_order_relaxed)) {
+        return;
+    }
+    try {
+        Ring* ring = impl->ringOfThisThread();
+        unsigned int kindId = 0;
+        auto it = ring->kindIds.find(&kind);
+        if (it != ring->kindIds.end()) {
+            kindId = it->second;
+        }
+        else {
+            kindId = impl->nextKindId.fetch_add(1, std::memory_order_relaxed);
+            if (!impl->append(ring, TraceOp::DefineKind, kindId, kind.name(), 0)) {
+                return;
+            }
+            ring->kindIds.emplace(&kind, kindId);
+        }
+        impl->append(ring, op, kindId, key, valueSize);
+    }
+    catch (...) {
+        impl->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+unsigned long long TraceRecorder::droppedRecords() const noexcept {
+    return impl->dropped.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,324 @@
+
+#include "client/TraceReplayer.h"
+#include "client/TraceRecorder.h"
+#include "api/librocks.h"
+#include "api/StatusCode.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring> // std::memcpy
+#include <exception>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    constexpr char MAGIC[8] = { 'L', 'R', 'T', 'R', 'A', 'C', 'E', '1' };
+    constexpr size_t RECORD_HEADER_SIZE = 1 + 4 + 4 + 8 + 4 + 4;
+
+    struct Record {
+        TraceOp op;
+        const Kind* kind;
+        unsigned long long micros;
+        size_t keyOffset;
+        size_t keyLen;
+        size_t valueSize;
+    };
+
+    struct RawRecord {
+        TraceOp op;
+        unsigned int thread;
+        unsigned int kindId;
+        unsigned long long micros;
+        size_t keyOffset;
+        size_t keyLen;
+        size_t valueSize;
+    };
+
+    template <typename T>
+    const char* get(const char* src, T* value) noexcept {
+        std::memcpy(value, src, sizeof(T));
+        return src + sizeof(T);
+    }
+
+    bool readFile(std::string_view path, std::vector<char>* content) {
+        std::FILE* file = std::fopen(std::string(path).c_str(), "rb");
+        if (!file) {
+            return false;
+        }
+        char buf[64 * 1024];
+        size_t n = 0;
+        while ((n = std::fread(buf, 1, sizeof(buf), file)) > 0) {
+            content->insert(content->end(), buf, buf + n);
+        }
+        bool ok = !std::ferror(file);
+        std::fclose(file);
+        return ok;
+    }
+
+    bool parse(const std::vector<char>& trace, std::vector<RawRecord>* records,
+        std::unordered_map<unsigned int, std::string>* kindNames) {
+        if (trace.size() < sizeof(MAGIC) || std::memcmp(trace.data(), MAGIC, sizeof(MAGIC)) != 0) {
+            return false;
+        }
+        size_t pos = sizeof(MAGIC);
+        while (pos < trace.size()) {
+            if (trace.size() - pos < RECORD_HEADER_SIZE) {
+                return false;
+            }
+            const char* p = trace.data() + pos;
+            unsigned char op = 0;
+            unsigned int keyLen = 0;
+            unsigned int valueSize = 0;
+            RawRecord rec {};
+            p = get(p, &op);
+            p = get(p, &rec.thread);
+            p = get(p, &rec.kindId);
+            p = get(p, &rec.micros);
+            p = get(p, &keyLen);
+            get(p, &valueSize);
+            pos += RECORD_HEADER_SIZE;
+            if (op > static_cast<unsigned char>(TraceOp::Contains) || trace.size() - pos < keyLen) {
+                return false;
+            }
+            rec.op = static_cast<TraceOp>(op);
+            rec.keyOffset = pos;
+            rec.keyLen = keyLen;
+            rec.valueSize = valueSize;
+            pos += keyLen;
+            if (rec.op == TraceOp::DefineKind) {
+                (*kindNames)[rec.kindId] = std::string(trace.data() + rec.keyOffset, rec.keyLen);
+            }
+            else {
+                records->push_back(rec);
+            }
+        }
+        return true;
+    }
+
+    bool isFailure(int status) noexcept {
+        return !(status == Status::Ok || status == Status::NotFound || status == Status::AlreadyExists);
+    }
+
+    int execute(Store* store, ExtendedStore* extended, const Record& rec, const char* key,
+        const char* filler) noexcept {
+        int status = Status::Ok;
+        size_t resultLen = 0;
+        switch (rec.op) {
+        case TraceOp::Put:
+            store->put(&status, *rec.kind, key, rec.keyLen, filler, rec.valueSize);
+            break;
+        case TraceOp::Get:
+            delete[] store->get(&status, *rec.kind, &resultLen, key, rec.keyLen);
+            break;
+        case TraceOp::Remove:
+            store->remove(&status, *rec.kind, key, rec.keyLen);
+            break;
+        case TraceOp::SingleRemove:
+            store->singleRemove(&status, *rec.kind, key, rec.keyLen);
+            break;
+        case TraceOp::PutIfAbsent:
+            store->putIfAbsent(&status, *rec.kind, key, rec.keyLen, filler, rec.valueSize);
+            break;
+        case TraceOp::UpdateIfPresent:
+            delete[] store->updateIfPresent(&status, *rec.kind, &resultLen, key, rec.keyLen, filler, rec.valueSize);
+            break;
+        case TraceOp::RemoveIfPresent:
+            delete[] store->removeIfPresent(&status, *rec.kind, &resultLen, key, rec.keyLen);
+            break;
+        case TraceOp::SingleRemoveIfPresent:
+            delete[] store->singleRemoveIfPresent(&status, *rec.kind, &resultLen, key, rec.keyLen);
+            break;
+        case TraceOp::Contains:
+            extended->contains(&status, *rec.kind, key, rec.keyLen);
+            break;
+        default:
+            break;
+        }
+        return status;
+    }
+
+    unsigned long long percentile(const std::vector<unsigned long long>& sorted, double q) noexcept {
+        size_t i = static_cast<size_t>(q * static_cast<double>(sorted.size()));
+        return sorted[std::min(i, sorted.size() - 1)];
+    }
+}
+
+TraceReplayReport TraceReplayer::replay(int* status, std::string_view tracePath, std::string_view storePath,
+    double speedup) noexcept {
+    TraceReplayReport report;
+    Store* store = nullptr;
+    try {
+        std::vector<char> trace;
+        if (!readFile(tracePath, &trace)) {
+            *status = Status::IOError;
+            return report;
+        }
+        std::vector<RawRecord> raw;
+        std::unordered_map<unsigned int, std::string> kindNames;
+        if (!parse(trace, &raw, &kindNames)) {
+            *status = Status::Corruption;
+            return report;
+        }
+
+        // replaying into an existing store would mix its data (and Kinds) into the results
+        std::error_code ec;
+        if (std::filesystem::exists(std::filesystem::path(storePath), ec) || ec) {
+            *status = ec ? Status::IOError : Status::InvalidArgument;
+            return report;
+        }
+
+        store = openStore(status, std::string(storePath).c_str());
+        if (*status != Status::Ok) {
+            delete store;
+            return report;
+        }
+        KindManager& kinds = store->getKindManager(status);
+        ExtendedStore* extended = *status == Status::Ok ? getExtendedStore(status, store) : nullptr;
+        if (*status != Status::Ok) {
+            store->close();
+            delete store;
+            return report;
+        }
+        std::unordered_map<unsigned int, const Kind*> resolved;
+        for (const auto& entry : kindNames) {
+            const Kind& kind = kinds.getOrCreateKind(status, entry.second.c_str());
+            if (*status != Status::Ok) {
+                store->close();
+                delete store;
+                return report;
+            }
+            resolved[entry.first] = &kind;
+        }
+
+        // records of a thread are in order in the trace, so grouping keeps them sorted
+        std::map<unsigned int, std::vector<Record>> byThread;
+        unsigned long long firstMicros = ~0ULL;
+        size_t maxValueSize = 0;
+        for (const RawRecord& r : raw) {
+            auto kind = resolved.find(r.kindId);
+            if (kind == resolved.end()) {
+                *status = Status::Corruption;
+                store->close();
+                delete store;
+                return report;
+            }
+            byThread[r.thread].push_back({ r.op, kind->second, r.micros, r.keyOffset, r.keyLen, r.valueSize });
+            firstMicros = std::min(firstMicros, r.micros);
+            maxValueSize = std::max(maxValueSize, r.valueSize);
+        }
+        std::vector<char> filler(maxValueSize > 0 ? maxValueSize : 1, 'x');
+
+        std::vector<std::vector<unsigned long long>> latencies(byThread.size());
+        std::vector<unsigned long long> failures(byThread.size(), 0);
+        // the first exception of any replay thread, the others stop early and the
+        // exception is rethrown only after all of them have been joined
+        std::exception_ptr failure;
+        std::mutex failureMutex;
+        std::atomic<bool> stop{ false };
+        auto fail = [&failure, &failureMutex, &stop]() noexcept {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failure) {
+                failure = std::current_exception();
+            }
+            stop.store(true, std::memory_order_relaxed);
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(byThread.size());
+        auto start = std::chrono::steady_clock::now();
+        try {
+            size_t t = 0;
+            for (const auto& entry : byThread) {
+                const std::vector<Record>* records = &entry.second;
+                std::vector<unsigned long long>* lat = &latencies[t];
+                unsigned long long* failed = &failures[t];
+                ++t;
+                threads.emplace_back([=, &trace, &filler, &stop, &fail]() noexcept {
+                    try {
+                        lat->reserve(records->size());
+                        for (const Record& rec : *records) {
+                            if (stop.load(std::memory_order_relaxed)) {
+                                break;
+                            }
+                            if (speedup > 0.0) {
+                                auto offset = std::chrono::duration<double, std::micro>(
+                                    static_cast<double>(rec.micros - firstMicros) / speedup);
+                                std::this_thread::sleep_until(start
+                                    + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset));
+                            }
+                            auto begin = std::chrono::steady_clock::now();
+                            int opStatus = execute(store, extended, rec, trace.data() + rec.keyOffset, filler.data());
+                            auto end = std::chrono::steady_clock::now();
+                            lat->push_back(static_cast<unsigned long long>(
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()));
+                            if (isFailure(opStatus)) {
+                                ++*failed;
+                            }
+                        }
+                    }
+                    catch (...) {
+                        fail();
+                    }
+                });
+            }
+        }
+        catch (...) {
+            // a replay thread couldn't be started
+            fail();
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        std::vector<unsigned long long> all;
+        all.reserve(raw.size());
+        for (const auto& lat : latencies) {
+            all.insert(all.end(), lat.begin(), lat.end());
+        }
+        for (unsigned long long failed : failures) {
+            report.failedOperations += failed;
+        }
+        store->close();
+        delete store;
+        store = nullptr;
+
+        report.operations = all.size();
+        report.elapsedNanos = static_cast<unsigned long long>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        if (report.elapsedNanos > 0) {
+            report.operationsPerSecond = static_cast<double>(report.operations) * 1e9
+                / static_cast<double>(report.elapsedNanos);
+        }
+        if (!all.empty()) {
+            std::sort(all.begin(), all.end());
+            unsigned long long sum = 0;
+            for (unsigned long long l : all) {
+                sum += l;
+            }
+            report.meanLatencyNanos = sum / all.size();
+            report.p50LatencyNanos = percentile(all, 0.50);
+            report.p99LatencyNanos = percentile(all, 0.99);
+            report.p999LatencyNanos = percentile(all, 0.999);
+            report.maxLatencyNanos = all.back();
+        }
+        *status = Status::Ok;
+        return report;
+    }
+    catch (...) {
+        if (store) {
+            store->close();
+            delete store;
+        }
+        *status = Status::Unknown;
+        return TraceReplayReport();
+    }
+}
@@ -0,0 +1,45 @@
+
+#include "client/ValueWriter.h"
+#include "client/KVStore.h"
+#include <algorithm>
+
+ValueWriter::ValueWriter(KVStore& kvStore, const Kind& kind, std::string_view key, size_t expectedSize)
+    : store(kvStore), kind(kind), key(key), firstBlockSize(expectedSize > 0 ? expectedSize : BLOCK_SIZE), total(0),
+    committed(false) {
+}
+
+void ValueWriter::append(std::string_view chunk) {
+    if (committed) {
+        KVStore::throwForStatus(Status::Invalid);
+    }
+    while (!chunk.empty()) {
+        if (blocks.empty() || blocks.back().size() == blocks.back().capacity()) {
+            blocks.emplace_back();
+            blocks.back().reserve(blocks.size() == 1 ? firstBlockSize : BLOCK_SIZE);
+        }
+        std::string& block = blocks.back();
+        size_t n = std::min(chunk.size(), block.capacity() - block.size());
+        block.append(chunk.data(), n);
+        chunk.remove_prefix(n);
+        total += n;
+    }
+}
+
+size_t ValueWriter::size() const noexcept {
+    return total;
+}
+
+bool ValueWriter::isCommitted() const noexcept {
+    return committed;
+}
+
+void ValueWriter::commit() {
+    if (committed) {
+        KVStore::throwForStatus(Status::Invalid);
+    }
+    std::vector<std::string_view> parts(blocks.begin(), blocks.end());
+    store.putParts(kind, key, parts, WriteOptions());
+    committed = true;
+    // release the blocks right away
+    std::vector<std::string>().swap(blocks);
+}
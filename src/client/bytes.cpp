@@ -1,9 +1,18 @@
 
 #include "client/bytes.h"
+#include <atomic>
 #include <cstring> // std::memcpy
 
+namespace {
+    std::atomic<unsigned long long> live { 0 };
+}
+
+bytes::bytes(char* bytes, size_t length) : size_(length), data_(bytes) {
+    live.fetch_add(length, std::memory_order_relaxed);
+}
+
 bytes::bytes(const bytes& other) : size_(0), data_(nullptr) {
-    if (other.size_ > 0) {
+    if (other.size_ > 0 || other.shared_) {
         copy(other);
     }
 }
@@ -11,7 +20,7 @@ bytes::bytes(const bytes& other) : size_(0), data_(nullptr) {
 bytes& bytes::operator=(const bytes& other) {
     if (this != &other) {
         clear();
-        if (other.size_ > 0) {
+        if (other.size_ > 0 || other.shared_) {
             copy(other);
         }
     }
@@ -32,7 +41,13 @@ bytes::~bytes() {
 }
 
 void bytes::clear() {
-    if (size_ > 0) {
+    if (shared_) {
+        size_ = 0;
+        data_ = nullptr;
+        shared_.reset();
+    }
+    else if (size_ > 0) {
+        live.fetch_sub(size_, std::memory_order_relaxed);
         size_ = 0;
         delete[] data_;
         data_ = nullptr;
@@ -42,11 +57,32 @@ void bytes::clear() {
 void bytes::swap(bytes& src) noexcept {
     std::swap(size_, src.size_);
     std::swap(data_, src.data_);
+    shared_.swap(src.shared_);
 }
 
 void bytes::copy(const bytes& other) {
+    if (other.shared_) {
+        size_ = other.size_;
+        data_ = other.data_;
+        shared_ = other.shared_;
+        return;
+    }
     size_ = other.size_;
     char* tmp = new char[other.size_];
     std::memcpy(tmp, other.data_, other.size_);
     data_ = tmp;
+    live.fetch_add(size_, std::memory_order_relaxed);
+}
+
+unsigned long long bytes::liveBytes() noexcept {
+    return live.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<const char[]> bytes::share(char* buf, size_t length) {
+    // added first, the deleter also runs if the control block can't be allocated
+    live.fetch_add(length, std::memory_order_relaxed);
+    return std::shared_ptr<const char[]>(buf, [length](const char* p) {
+        live.fetch_sub(length, std::memory_order_relaxed);
+        delete[] p;
+    });
 }
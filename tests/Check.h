@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdio>
+
+// Minimal checks for the test runner (TestMain.cpp): a failed check is
+// reported with its location and counted, the test itself keeps running.
+// The runner's exit code is the number of failed checks.
+
+extern int failedChecks;
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            ++failedChecks; \
+            std::printf("%s(%d): CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+        } \
+    } while (0)
+
+#ifdef __cplusplus_cli
+
+#define CHECK_THROWS(ExceptionType, expression) \
+    do { \
+        bool thrown = false; \
+        try { \
+            expression; \
+        } \
+        catch (ExceptionType^) { \
+            thrown = true; \
+        } \
+        if (!thrown) { \
+            ++failedChecks; \
+            std::printf("%s(%d): %s didn't throw %s\n", __FILE__, __LINE__, #expression, #ExceptionType); \
+        } \
+    } while (0)
+
+#endif
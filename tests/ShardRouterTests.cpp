@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Check.h"
+#include "client/ShardRouter.h"
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> paths(const std::string& prefix, size_t count) {
+        std::vector<std::string> result;
+        for (size_t i = 0; i < count; ++i) {
+            result.push_back(prefix + std::to_string(i));
+        }
+        return result;
+    }
+}
+
+// the placement is persistent, so it must be the same for every build and platform,
+// must not depend on the shards' paths, and appending a shard may only move keys to it
+void shardRouterPlacementIsStable() {
+    // computed once from the FNV-1a / ring spec in ShardRouter.cpp, these must never change
+    const size_t expected[16] = { 3, 1, 1, 2, 1, 0, 2, 3, 0, 1, 2, 2, 3, 0, 0, 1 };
+
+    ShardRouter router;
+    CHECK(router.init(ShardRouting::ConsistentHash, paths("D:/shards/", 4), {}, 128));
+    for (size_t i = 0; i < 16; ++i) {
+        CHECK(router.shardFor("key" + std::to_string(i)) == expected[i]);
+    }
+
+    ShardRouter moved;
+    CHECK(moved.init(ShardRouting::ConsistentHash, paths("E:/elsewhere/", 4), {}, 128));
+    ShardRouter grown;
+    CHECK(grown.init(ShardRouting::ConsistentHash, paths("D:/shards/", 5), {}, 128));
+    for (size_t i = 0; i < 10000; ++i) {
+        std::string key = "user:" + std::to_string(i);
+        size_t shard = router.shardFor(key);
+        CHECK(moved.shardFor(key) == shard);
+        size_t grownShard = grown.shardFor(key);
+        CHECK(grownShard == shard || grownShard == 4);
+    }
+}
+
+// shard i holds [splitKeys[i - 1], splitKeys[i])
+void shardRouterRangeBounds() {
+    ShardRouter router;
+    CHECK(!router.init(ShardRouting::Range, paths("D:/shards/", 3), { "m" }, 0));
+    CHECK(!router.init(ShardRouting::Range, paths("D:/shards/", 3), { "t", "g" }, 0));
+    CHECK(router.init(ShardRouting::Range, paths("D:/shards/", 3), { "g", "t" }, 0));
+    CHECK(router.shardFor("") == 0);
+    CHECK(router.shardFor("f") == 0);
+    CHECK(router.shardFor("g") == 1);
+    CHECK(router.shardFor("s") == 1);
+    CHECK(router.shardFor("t") == 2);
+    CHECK(router.shardFor("zzz") == 2);
+    CHECK(router.shardsFor("a", "g") == std::vector<size_t>({ 0 }));
+    CHECK(router.shardsFor("a", "h") == std::vector<size_t>({ 0, 1 }));
+    CHECK(router.shardsFor("h", std::string_view()) == std::vector<size_t>({ 1, 2 }));
+    CHECK(router.shardsFor(std::string_view(), std::string_view()) == std::vector<size_t>({ 0, 1, 2 }));
+}
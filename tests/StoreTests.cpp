@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Check.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::IO;
+using namespace System::Text;
+using namespace librocks::Net;
+
+#pragma warning(push)
+#pragma warning(disable:4996)
+
+namespace {
+    // every test works on a fresh store in its own temp directory
+    String^ newStorePath() {
+        return Path::Combine(Path::GetTempPath(), "librocks.NET.Tests", Guid::NewGuid().ToString());
+    }
+
+    void deleteStore(String^ path) {
+        if (Directory::Exists(path)) {
+            Directory::Delete(path, true);
+        }
+    }
+
+    ReadOnlySpan<Byte> key(String^ s) {
+        return ReadOnlySpan<Byte>(Encoding::UTF8->GetBytes(s));
+    }
+
+    // nullptr if the key doesn't exist
+    String^ text(NativeBytes^ value) {
+        if (value == nullptr) {
+            return nullptr;
+        }
+        String^ s = value->ToString();
+        delete value;
+        return s;
+    }
+}
+
+// a snapshot keeps seeing the state at the time it was taken, and it can
+// only be used with the store it was taken from and only until it's released
+void snapshotIsolation() {
+    String^ path = newStorePath();
+    String^ otherPath = newStorePath();
+    KeyValueStore^ store = gcnew KeyValueStore(path);
+    KeyValueStore^ other = gcnew KeyValueStore(otherPath);
+    try {
+        Kind^ kind = store->GetDefaultKind();
+        store->Put(kind, key("a"), key("1"));
+        store->Put(kind, key("b"), key("1"));
+        Snapshot^ snapshot = store->GetSnapshot();
+
+        store->Put(kind, key("a"), key("2"));
+        store->Remove(kind, key("b"));
+        store->Put(kind, key("c"), key("2"));
+
+        CHECK(text(store->Get(kind, key("a"), snapshot)) == "1");
+        CHECK(text(store->Get(kind, key("b"), snapshot)) == "1");
+        CHECK(text(store->Get(kind, key("c"), snapshot)) == nullptr);
+        CHECK(text(store->Get(kind, key("a"))) == "2");
+        CHECK(text(store->Get(kind, key("b"))) == nullptr);
+
+        List<array<Byte>^>^ keys = gcnew List<array<Byte>^>();
+        keys->Add(Encoding::UTF8->GetBytes("a"));
+        keys->Add(Encoding::UTF8->GetBytes("b"));
+        keys->Add(Encoding::UTF8->GetBytes("c"));
+        IReadOnlyList<NativeBytes^>^ values = store->MultiGet(kind, keys, snapshot);
+        CHECK(values->Count == 3);
+        CHECK(text(values[0]) == "1");
+        CHECK(text(values[1]) == "1");
+        CHECK(text(values[2]) == nullptr);
+
+        CHECK_THROWS(ArgumentException, other->Get(other->GetDefaultKind(), key("a"), snapshot));
+
+        delete snapshot;
+        CHECK(snapshot->IsReleased);
+        CHECK_THROWS(ObjectDisposedException, store->Get(kind, key("a"), snapshot));
+    }
+    finally {
+        delete other;
+        delete store;
+        deleteStore(otherPath);
+        deleteStore(path);
+    }
+}
+
+// closing the store releases its snapshots, they can't be used afterwards
+void snapshotsCloseWithStore() {
+    String^ path = newStorePath();
+    KeyValueStore^ store = gcnew KeyValueStore(path);
+    try {
+        store->Put(store->GetDefaultKind(), key("k"), key("v"));
+        Snapshot^ snapshot = store->GetSnapshot();
+        CHECK(!snapshot->IsReleased);
+        CHECK(snapshot->SequenceNumber == store->LatestSequenceNumber);
+        delete store;
+        CHECK(snapshot->IsReleased);
+        UInt64 sequenceNumber = 0;
+        CHECK_THROWS(ObjectDisposedException, sequenceNumber = snapshot->SequenceNumber);
+        delete snapshot;
+    }
+    finally {
+        delete store;
+        deleteStore(path);
+    }
+}
+
+// [begin, end) is purged, an empty begin starts at the first key and
+// PurgeRangeFrom() runs to the end, but an empty end is rejected
+void purgeRangeBounds() {
+    String^ path = newStorePath();
+    KeyValueStore^ store = gcnew KeyValueStore(path);
+    try {
+        Kind^ kind = store->GetDefaultKind();
+        for each (String^ k in gcnew array<String^>{ "a", "b", "c", "d", "e", "f" }) {
+            store->Put(kind, key(k), key("x"));
+        }
+
+        store->PurgeRange(kind, key("b"), key("d"));
+        CHECK(store->Contains(kind, key("a")));
+        CHECK(!store->Contains(kind, key("b")));
+        CHECK(!store->Contains(kind, key("c")));
+        CHECK(store->Contains(kind, key("d")));
+
+        CHECK_THROWS(ArgumentException, store->PurgeRange(kind, key("d"), ReadOnlySpan<Byte>()));
+        CHECK(store->Contains(kind, key("d")));
+
+        store->PurgeRange(kind, ReadOnlySpan<Byte>(), key("b"));
+        CHECK(!store->Contains(kind, key("a")));
+        CHECK(store->Contains(kind, key("d")));
+
+        store->PurgeRangeFrom(kind, key("e"));
+        CHECK(store->Contains(kind, key("d")));
+        CHECK(!store->Contains(kind, key("e")));
+        CHECK(!store->Contains(kind, key("f")));
+    }
+    finally {
+        delete store;
+        deleteStore(path);
+    }
+}
+
+// a cached value never outlives the write that replaces or removes it
+void cacheInvalidationOnWrite() {
+    String^ path = newStorePath();
+    KeyValueStoreOptions^ options = gcnew KeyValueStoreOptions();
+    options->ReadCacheCapacity = 1 << 20;
+    KeyValueStore^ store = gcnew KeyValueStore(path, options);
+    try {
+        Kind^ kind = store->GetDefaultKind();
+        store->Put(kind, key("k"), key("1"));
+        CHECK(text(store->Get(kind, key("k"))) == "1");
+        CHECK(text(store->Get(kind, key("k"))) == "1");
+        CHECK(store->GetReadCacheStats().Hits >= 1);
+
+        store->Put(kind, key("k"), key("2"));
+        CHECK(text(store->Get(kind, key("k"))) == "2");
+
+        store->Remove(kind, key("k"));
+        CHECK(text(store->Get(kind, key("k"))) == nullptr);
+
+        store->Put(kind, key("k"), key("3"));
+        CHECK(text(store->Get(kind, key("k"))) == "3");
+        store->RemoveRange(kind, key("a"), key("z"));
+        CHECK(text(store->Get(kind, key("k"))) == nullptr);
+    }
+    finally {
+        delete store;
+        deleteStore(path);
+    }
+}
+
+// a ranged Get only returns null for a missing key, an offset at or past the end gives an empty result
+void rangedGetBounds() {
+    String^ path = newStorePath();
+    KeyValueStore^ store = gcnew KeyValueStore(path);
+    try {
+        Kind^ kind = store->GetDefaultKind();
+        store->Put(kind, key("k"), key("0123456789"));
+
+        CHECK(text(store->Get(kind, key("k"), 2, 3)) == "234");
+        CHECK(text(store->Get(kind, key("k"), 8, Int32::MaxValue)) == "89");
+        CHECK(text(store->Get(kind, key("k"), 10, 5)) == "");
+        CHECK(text(store->Get(kind, key("k"), 20, 5)) == "");
+        CHECK(text(store->Get(kind, key("k"), 0, 0)) == "");
+        CHECK(text(store->Get(kind, key("missing"), 0, Int32::MaxValue)) == nullptr);
+
+        String^ large = gcnew String('x', 4096);
+        store->Put(kind, key("large"), key(large));
+        CHECK(text(store->Get(kind, key("large"), 96, Int32::MaxValue)) == large->Substring(96));
+    }
+    finally {
+        delete store;
+        deleteStore(path);
+    }
+}
+
+#pragma warning(pop)
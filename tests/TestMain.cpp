@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 Stefan Zobel
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "Check.h"
+
+using namespace System;
+
+int failedChecks = 0;
+
+// StoreTests.cpp
+void snapshotIsolation();
+void snapshotsCloseWithStore();
+void purgeRangeBounds();
+void cacheInvalidationOnWrite();
+void rangedGetBounds();
+
+// ShardRouterTests.cpp
+void shardRouterPlacementIsStable();
+void shardRouterRangeBounds();
+
+namespace {
+    void run(const char* name, void (*test)()) {
+        std::printf("%s\n", name);
+        try {
+            test();
+        }
+        catch (Exception^ e) {
+            ++failedChecks;
+            Console::WriteLine("  unexpected {0}: {1}", e->GetType()->Name, e->Message);
+        }
+        catch (...) {
+            ++failedChecks;
+            std::printf("  unexpected native exception\n");
+        }
+    }
+}
+
+int main() {
+    run("snapshot isolation", snapshotIsolation);
+    run("snapshots close with the store", snapshotsCloseWithStore);
+    run("PurgeRange bounds", purgeRangeBounds);
+    run("cache invalidation on write", cacheInvalidationOnWrite);
+    run("ranged Get bounds", rangedGetBounds);
+    run("ShardRouter placement stability", shardRouterPlacementIsStable);
+    run("ShardRouter range bounds", shardRouterRangeBounds);
+    if (failedChecks == 0) {
+        std::printf("all tests passed\n");
+    }
+    else {
+        std::printf("%d check(s) failed\n", failedChecks);
+    }
+    return failedChecks;
+}